@@ -239,6 +239,16 @@ void MEM_enable_fail_on_memleak(void);
  * NOTE: The switch between allocator types can only happen before any allocation did happen. */
 void MEM_use_lockfree_allocator(void);
 
+/* Keep freed small blocks in per-thread caches of the lock-free allocator, to reuse them for
+ * following allocations of the same size class without going through the system allocator.
+ *
+ * Reduces allocator contention with many threads doing temporary allocations, at the cost of
+ * a few megabytes per thread which are not reported as memory in use. Blocks are only returned to
+ * the system when a cache is full or its thread exits.
+ *
+ * NOTE: Unlike the allocator type, this can be changed at any time. */
+void MEM_use_lockfree_thread_cache(bool enabled);
+
 /* Switch allocator to slow fully guarded mode.
  *
  * Use for debug purposes. This allocator contains lock section around every allocator call, which
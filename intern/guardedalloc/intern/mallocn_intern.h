@@ -118,6 +118,27 @@ size_t memory_usage_current(void);
 size_t memory_usage_peak(void);
 void memory_usage_peak_reset(void);
 
+/* Blocks up to this size are cached per thread when #MEM_use_lockfree_thread_cache is enabled.
+ * Cached blocks are grouped in size classes which are multiples of the step size. */
+#define MEM_THREAD_CACHE_SIZE_MAX 1024
+#define MEM_THREAD_CACHE_SIZE_STEP 16
+#define MEM_THREAD_CACHE_CLASSES_NUM (MEM_THREAD_CACHE_SIZE_MAX / MEM_THREAD_CACHE_SIZE_STEP + 1)
+
+/**
+ * Take a block of the given size class from the cache of the current thread. The block size is
+ * the number of bytes allocated from the system for blocks of that class.
+ * Returns NULL when the cache has no such block.
+ */
+void *mem_thread_cache_pop(size_t size_class, size_t block_size);
+/**
+ * Give a block of the given size class to the cache of the current thread. The block is the
+ * pointer returned by the system allocator, and must be at least pointer sized.
+ * Returns false when the cache is full, in which case the caller is responsible for freeing it.
+ */
+bool mem_thread_cache_push(void *block, size_t size_class, size_t block_size);
+/** Number of bytes currently held by the caches of all threads. */
+size_t mem_thread_cache_size(void);
+
 /**
  * Clear the listbase of allocated memory blocks.
  *
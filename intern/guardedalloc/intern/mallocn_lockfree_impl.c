@@ -39,18 +39,28 @@ typedef struct MemHeadAligned {
 } MemHeadAligned;
 
 static bool malloc_debug_memset = false;
+static bool use_thread_cache = false;
 
 static void (*error_callback)(const char *) = NULL;
 
 enum {
   MEMHEAD_ALIGN_FLAG = 1,
+  /* The block is allocated with the size of its thread cache size class. */
+  MEMHEAD_CACHED_FLAG = 2,
 };
 
 #define MEMHEAD_FROM_PTR(ptr) (((MemHead *)ptr) - 1)
 #define PTR_FROM_MEMHEAD(memhead) (memhead + 1)
 #define MEMHEAD_ALIGNED_FROM_PTR(ptr) (((MemHeadAligned *)ptr) - 1)
 #define MEMHEAD_IS_ALIGNED(memhead) ((memhead)->len & (size_t)MEMHEAD_ALIGN_FLAG)
-#define MEMHEAD_LEN(memhead) ((memhead)->len & ~((size_t)(MEMHEAD_ALIGN_FLAG)))
+#define MEMHEAD_IS_CACHED(memhead) ((memhead)->len & (size_t)MEMHEAD_CACHED_FLAG)
+#define MEMHEAD_LEN(memhead) \
+  ((memhead)->len & ~((size_t)(MEMHEAD_ALIGN_FLAG | MEMHEAD_CACHED_FLAG)))
+
+#define THREAD_CACHE_SIZE_CLASS(len) \
+  (((len) + MEM_THREAD_CACHE_SIZE_STEP - 1) / MEM_THREAD_CACHE_SIZE_STEP)
+#define THREAD_CACHE_BLOCK_SIZE(size_class) \
+  ((size_class) * MEM_THREAD_CACHE_SIZE_STEP + sizeof(MemHead))
 
 #ifdef __GNUC__
 __attribute__((format(printf, 1, 2)))
@@ -71,6 +81,40 @@ print_error(const char *str, ...)
   }
 }
 
+/**
+ * Allocate a block for `len` bytes of user data, taking it from the thread cache when possible.
+ * Only the flags are set in the returned head, the caller adds the length.
+ */
+static MemHead *memhead_alloc(const size_t len, const bool clear)
+{
+  MemHead *memh;
+
+  if (use_thread_cache && len <= MEM_THREAD_CACHE_SIZE_MAX) {
+    const size_t size_class = THREAD_CACHE_SIZE_CLASS(len);
+    const size_t block_size = THREAD_CACHE_BLOCK_SIZE(size_class);
+
+    memh = (MemHead *)mem_thread_cache_pop(size_class, block_size);
+    if (memh) {
+      if (clear) {
+        memset(memh + 1, 0, len);
+      }
+    }
+    else {
+      memh = (MemHead *)(clear ? calloc(1, block_size) : malloc(block_size));
+    }
+    if (LIKELY(memh)) {
+      memh->len = (size_t)MEMHEAD_CACHED_FLAG;
+    }
+    return memh;
+  }
+
+  memh = (MemHead *)(clear ? calloc(1, len + sizeof(MemHead)) : malloc(len + sizeof(MemHead)));
+  if (LIKELY(memh)) {
+    memh->len = 0;
+  }
+  return memh;
+}
+
 size_t MEM_lockfree_allocN_len(const void *vmemh)
 {
   if (LIKELY(vmemh)) {
@@ -106,6 +150,14 @@ void MEM_lockfree_freeN(void *vmemh)
     MemHeadAligned *memh_aligned = MEMHEAD_ALIGNED_FROM_PTR(vmemh);
     aligned_free(MEMHEAD_REAL_PTR(memh_aligned));
   }
+  else if (MEMHEAD_IS_CACHED(memh) && use_thread_cache) {
+    /* Blocks allocated while the cache was enabled may still be freed after it has been
+     * disabled, don't cache those, #memhead_alloc would never reuse them. */
+    const size_t size_class = THREAD_CACHE_SIZE_CLASS(len);
+    if (!mem_thread_cache_push(memh, size_class, THREAD_CACHE_BLOCK_SIZE(size_class))) {
+      free(memh);
+    }
+  }
   else {
     free(memh);
   }
@@ -213,10 +265,10 @@ void *MEM_lockfree_callocN(size_t len, const char *str)
 
   len = SIZET_ALIGN_4(len);
 
-  memh = (MemHead *)calloc(1, len + sizeof(MemHead));
+  memh = memhead_alloc(len, true);
 
   if (LIKELY(memh)) {
-    memh->len = len;
+    memh->len |= len;
     memory_usage_block_alloc(len);
 
     return PTR_FROM_MEMHEAD(memh);
@@ -255,7 +307,7 @@ void *MEM_lockfree_mallocN(size_t len, const char *str)
 #endif
   len = SIZET_ALIGN_4(len);
 
-  memh = (MemHead *)malloc(len + sizeof(MemHead));
+  memh = memhead_alloc(len, false);
 
   if (LIKELY(memh)) {
 
@@ -273,7 +325,7 @@ void *MEM_lockfree_mallocN(size_t len, const char *str)
 #endif /* WITH_MEM_VALGRIND */
     }
 
-    memh->len = len;
+    memh->len |= len;
     memory_usage_block_alloc(len);
 
     return PTR_FROM_MEMHEAD(memh);
@@ -383,6 +435,10 @@ void MEM_lockfree_printmemlist_stats(void)
 {
   printf("\ntotal memory len: %.3f MB\n", (double)memory_usage_current() / (double)(1024 * 1024));
   printf("peak memory len: %.3f MB\n", (double)memory_usage_peak() / (double)(1024 * 1024));
+  if (use_thread_cache) {
+    printf("thread cache len: %.3f MB\n",
+           (double)mem_thread_cache_size() / (double)(1024 * 1024));
+  }
   printf(
       "\nFor more detailed per-block statistics run Blender with memory debugging command line "
       "argument.\n");
@@ -408,6 +464,11 @@ void MEM_lockfree_set_memory_debug(void)
   malloc_debug_memset = true;
 }
 
+void MEM_use_lockfree_thread_cache(bool enabled)
+{
+  use_thread_cache = enabled;
+}
+
 size_t MEM_lockfree_get_memory_in_use(void)
 {
   return memory_usage_current();
@@ -0,0 +1,162 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup intern_mem
+ *
+ * Per-thread caches of small memory blocks for the lock-free allocator.
+ *
+ * Many temporary allocations (small arrays, vectors, linear allocator chunks, ...) are freed
+ * shortly after they have been allocated, often by the same thread. Keeping a bounded number of
+ * such blocks per thread avoids going through the system allocator, which can become a point of
+ * contention with many threads.
+ *
+ * Blocks are returned to the cache of the thread that frees them. This avoids any synchronization
+ * between threads, the per-size-class limits keep caches from growing when one thread allocates
+ * and another one frees.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+#include "MEM_guardedalloc.h"
+#include "mallocn_intern.h"
+
+#include "../../source/blender/blenlib/BLI_strict_flags.h"
+
+namespace {
+
+/**
+ * Maximum number of bytes kept per size class and thread. With all size classes filled up, a
+ * thread keeps about 4 MB.
+ */
+constexpr size_t bin_size_max = 64 * 1024;
+
+struct ThreadCacheBin {
+  /** Singly linked list of free blocks, the link is stored at the start of each block. */
+  void *first = nullptr;
+  size_t size = 0;
+};
+
+/**
+ * This is trivially destructible, so that it can still be accessed (and is ignored) when
+ * thread-local objects with destructors that free memory are destructed after #ThreadCacheOwner.
+ */
+struct ThreadCache {
+  ThreadCacheBin bins[MEM_THREAD_CACHE_CLASSES_NUM];
+  /** Only written by the owning thread, read by others when computing statistics. */
+  std::atomic<int64_t> size = 0;
+  bool is_registered = false;
+  /** The thread is exiting, don't cache any more blocks. */
+  bool is_destructed = false;
+};
+
+struct ThreadCacheRegistry {
+  std::mutex mutex;
+  std::vector<ThreadCache *> caches;
+};
+
+ThreadCacheRegistry &get_registry()
+{
+  /* Never destructed, threads may still exit while static variables are being destructed. */
+  static ThreadCacheRegistry *registry = new ThreadCacheRegistry();
+  return *registry;
+}
+
+thread_local ThreadCache thread_cache;
+
+/** Frees the cached blocks when the thread exits. */
+struct ThreadCacheOwner {
+  ThreadCacheOwner()
+  {
+    ThreadCacheRegistry &registry = get_registry();
+    std::lock_guard lock{registry.mutex};
+    registry.caches.push_back(&thread_cache);
+  }
+
+  ~ThreadCacheOwner()
+  {
+    ThreadCache &cache = thread_cache;
+    {
+      ThreadCacheRegistry &registry = get_registry();
+      std::lock_guard lock{registry.mutex};
+      registry.caches.erase(std::find(registry.caches.begin(), registry.caches.end(), &cache));
+    }
+    for (ThreadCacheBin &bin : cache.bins) {
+      while (bin.first) {
+        void *block = bin.first;
+        bin.first = *static_cast<void **>(block);
+        free(block);
+      }
+      bin.size = 0;
+    }
+    cache.size.store(0, std::memory_order_relaxed);
+    cache.is_destructed = true;
+  }
+};
+
+ThreadCache *ensure_thread_cache()
+{
+  ThreadCache &cache = thread_cache;
+  if (UNLIKELY(cache.is_destructed)) {
+    return nullptr;
+  }
+  if (UNLIKELY(!cache.is_registered)) {
+    /* Set before constructing the owner, which may allocate and free memory itself. */
+    cache.is_registered = true;
+    static thread_local ThreadCacheOwner owner;
+  }
+  return &cache;
+}
+
+}  // namespace
+
+void *mem_thread_cache_pop(const size_t size_class, const size_t block_size)
+{
+  /* No need to register the cache here, it only contains blocks after a push. */
+  ThreadCache &cache = thread_cache;
+  ThreadCacheBin &bin = cache.bins[size_class];
+  void *block = bin.first;
+  if (block == nullptr) {
+    return nullptr;
+  }
+  bin.first = *static_cast<void **>(block);
+  bin.size -= block_size;
+  cache.size.store(cache.size.load(std::memory_order_relaxed) - int64_t(block_size),
+                   std::memory_order_relaxed);
+  return block;
+}
+
+bool mem_thread_cache_push(void *block, const size_t size_class, const size_t block_size)
+{
+  ThreadCache *cache = ensure_thread_cache();
+  if (cache == nullptr) {
+    return false;
+  }
+  ThreadCacheBin &bin = cache->bins[size_class];
+  if (bin.size + block_size > bin_size_max) {
+    return false;
+  }
+  *static_cast<void **>(block) = bin.first;
+  bin.first = block;
+  bin.size += block_size;
+  cache->size.store(cache->size.load(std::memory_order_relaxed) + int64_t(block_size),
+                    std::memory_order_relaxed);
+  return true;
+}
+
+size_t mem_thread_cache_size()
+{
+  ThreadCacheRegistry &registry = get_registry();
+  std::lock_guard lock{registry.mutex};
+
+  int64_t size = 0;
+  for (const ThreadCache *cache : registry.caches) {
+    size += cache->size.load(std::memory_order_relaxed);
+  }
+  return size_t(size);
+}
@@ -0,0 +1,101 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "testing/testing.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "guardedalloc_test_base.h"
+
+namespace {
+
+class LockFreeThreadCacheAllocatorTest : public LockFreeAllocatorTest {
+ protected:
+  void SetUp() override
+  {
+    LockFreeAllocatorTest::SetUp();
+    MEM_use_lockfree_thread_cache(true);
+  }
+
+  void TearDown() override
+  {
+    MEM_use_lockfree_thread_cache(false);
+  }
+};
+
+}  // namespace
+
+TEST_F(LockFreeThreadCacheAllocatorTest, ReuseBlock)
+{
+  const size_t blocks_num = MEM_get_memory_blocks_in_use();
+  const size_t mem_in_use = MEM_get_memory_in_use();
+
+  void *a = MEM_mallocN(100, __func__);
+  EXPECT_EQ(MEM_allocN_len(a), size_t(100));
+  EXPECT_EQ(MEM_get_memory_blocks_in_use(), blocks_num + 1);
+  EXPECT_EQ(MEM_get_memory_in_use(), mem_in_use + 100);
+  MEM_freeN(a);
+  EXPECT_EQ(MEM_get_memory_blocks_in_use(), blocks_num);
+  EXPECT_EQ(MEM_get_memory_in_use(), mem_in_use);
+
+  /* Same size class. */
+  void *b = MEM_mallocN(104, __func__);
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(MEM_allocN_len(b), size_t(104));
+  MEM_freeN(b);
+}
+
+TEST_F(LockFreeThreadCacheAllocatorTest, CallocClearsReusedBlock)
+{
+  char *a = static_cast<char *>(MEM_mallocN(64, __func__));
+  memset(a, 0xff, 64);
+  MEM_freeN(a);
+
+  char *b = static_cast<char *>(MEM_callocN(64, __func__));
+  for (int i = 0; i < 64; i++) {
+    EXPECT_EQ(b[i], 0);
+  }
+  MEM_freeN(b);
+}
+
+TEST_F(LockFreeThreadCacheAllocatorTest, Realloc)
+{
+  int *a = static_cast<int *>(MEM_malloc_arrayN(4, sizeof(int), __func__));
+  for (int i = 0; i < 4; i++) {
+    a[i] = i;
+  }
+  /* Grow beyond the cached sizes. */
+  a = static_cast<int *>(MEM_recallocN(a, 4096 * sizeof(int)));
+  EXPECT_EQ(MEM_allocN_len(a), 4096 * sizeof(int));
+  for (int i = 0; i < 4; i++) {
+    EXPECT_EQ(a[i], i);
+  }
+  EXPECT_EQ(a[4095], 0);
+  a = static_cast<int *>(MEM_reallocN(a, 2 * sizeof(int)));
+  EXPECT_EQ(a[1], 1);
+  MEM_freeN(a);
+}
+
+TEST_F(LockFreeThreadCacheAllocatorTest, FreeOnOtherThread)
+{
+  const size_t blocks_num = MEM_get_memory_blocks_in_use();
+
+  std::vector<void *> blocks;
+  for (int i = 0; i < 1000; i++) {
+    blocks.push_back(MEM_mallocN(size_t(i), __func__));
+  }
+  std::thread thread([&]() {
+    for (void *block : blocks) {
+      MEM_freeN(block);
+    }
+    /* Cached blocks of this thread are freed when it exits. */
+  });
+  thread.join();
+
+  EXPECT_EQ(MEM_get_memory_blocks_in_use(), blocks_num);
+}
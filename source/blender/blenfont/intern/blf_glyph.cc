@@ -1430,7 +1430,9 @@ void blf_glyph_draw(FontBLF *font, GlyphCacheBLF *gc, GlyphBLF *g, const int x,
 
     if (bitmap_len > gc->bitmap_len_alloc) {
       int w = font->tex_size_max;
-      int h = bitmap_len / w + 1;
+      /* Grow the number of rows geometrically: re-creating the texture means all glyphs of this
+       * cache have to be uploaded again, which is slow when many glyphs are added one by one. */
+      int h = std::max(bitmap_len / w + 1, std::min(2 * (gc->bitmap_len_alloc / w), w));
 
       gc->bitmap_len_alloc = w * h;
       gc->bitmap_result = static_cast<char *>(
@@ -59,6 +59,8 @@ struct NodeBakeCache {
   std::optional<std::string> blobs_dir;
   /** Used to avoid reading blobs multiple times for different frames. */
   std::unique_ptr<BlobReadSharing> blob_sharing;
+  /** Kept alive with the cache, so that blob files are only mapped once for all frames. */
+  std::unique_ptr<DiskBlobReader> blob_reader;
   /** Used to avoid checking if a bake exists many times. */
   bool failed_finding_bake = false;
 
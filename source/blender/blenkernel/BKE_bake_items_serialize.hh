@@ -10,6 +10,8 @@
 
 #include "BKE_bake_items.hh"
 
+struct BLI_mmap_file;
+
 namespace blender::bke::bake {
 
 /**
@@ -151,11 +153,20 @@ class DiskBlobReader : public BlobReader {
  private:
   const std::string blobs_dir_;
   mutable std::mutex mutex_;
+  /**
+   * Blob files are memory mapped, so that reading a slice is a single copy. The mapping may
+   * be null when the file could not be mapped, in which case it is read with a stream instead.
+   */
+  mutable Map<std::string, BLI_mmap_file *> mapped_files_;
   mutable Map<std::string, std::unique_ptr<fstream>> open_input_streams_;
 
  public:
   DiskBlobReader(std::string blobs_dir);
+  ~DiskBlobReader();
   [[nodiscard]] bool read(const BlobSlice &slice, void *r_data) const override;
+
+ private:
+  BLI_mmap_file *ensure_mapped_file(const std::string &blob_path) const;
 };
 
 /**
@@ -159,6 +159,9 @@ struct BVHTreeFromPointCloud {
   BVHTree_NearestPointCallback nearest_callback;
 
   const float (*coords)[3];
+
+  /* Private data */
+  bool cached;
 };
 
 void BKE_bvhtree_from_pointcloud_get(const PointCloud &pointcloud,
@@ -175,6 +178,11 @@ void free_bvhtree_from_pointcloud(BVHTreeFromPointCloud *data);
 
 bool bvhcache_has_tree(const BVHCache *bvh_cache, const BVHTree *tree);
 BVHCache *bvhcache_init();
+/**
+ * Keep trees that can be refit to the new positions of the same elements when they are requested
+ * again, and free all other trees.
+ */
+void bvhcache_tag_positions_changed(BVHCache *bvh_cache);
 /**
  * Frees a BVH-cache.
  */
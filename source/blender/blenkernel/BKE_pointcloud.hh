@@ -9,6 +9,7 @@
  * \brief General operations for point clouds.
  */
 
+#include <memory>
 #include <mutex>
 
 #include "BLI_bounds_types.hh"
@@ -17,6 +18,7 @@
 
 #include "DNA_pointcloud_types.h"
 
+struct BVHTree;
 struct Depsgraph;
 struct Main;
 struct Object;
@@ -32,6 +34,10 @@ extern const char *POINTCLOUD_ATTR_RADIUS;
 
 namespace blender::bke {
 
+struct BVHTreeDeleter {
+  void operator()(BVHTree *tree);
+};
+
 struct PointCloudRuntime {
   /**
    * A cache of bounds shared between data-blocks with unchanged positions and radii.
@@ -40,6 +46,12 @@ struct PointCloudRuntime {
    */
   mutable SharedCache<Bounds<float3>> bounds_cache;
 
+  /**
+   * A BVH tree containing all points, shared between data-blocks with unchanged positions. This
+   * allows reusing the tree when the same static point cloud is sampled many times.
+   */
+  mutable SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache;
+
   /** Stores weak references to material data blocks. */
   std::unique_ptr<bake::BakeMaterialsList> bake_materials;
 
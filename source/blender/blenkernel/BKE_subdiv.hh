@@ -17,6 +17,7 @@ struct OpenSubdiv_Converter;
 struct OpenSubdiv_Evaluator;
 struct OpenSubdiv_TopologyRefiner;
 struct Subdiv;
+struct SubdivTopologyFingerprint;
 
 enum eSubdivVtxBoundaryInterpolation {
   /* Do not interpolate boundaries. */
@@ -159,6 +160,9 @@ struct Subdiv {
    * topology to OpenSubdiv. It can be shared by both evaluator and GL mesh
    * drawer. */
   OpenSubdiv_TopologyRefiner *topology_refiner;
+  /* Identifies the mesh data the topology refiner was created from, used to skip comparing the
+   * topology when the same data is used again. Can be null. */
+  SubdivTopologyFingerprint *topology_fingerprint;
   /* CPU side evaluator. */
   OpenSubdiv_Evaluator *evaluator;
   /* Optional displacement evaluator. */
@@ -16,6 +16,12 @@ class WindowManagerRuntime {
   /** Information and error reports. */
   ReportList reports;
 
+  /**
+   * Data may have changed since the last auto-save was written.
+   * When cleared, writing the auto-save file again can be skipped.
+   */
+  bool autosave_is_outdated = true;
+
   WindowManagerRuntime();
   ~WindowManagerRuntime();
 };
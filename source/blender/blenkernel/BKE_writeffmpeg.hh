@@ -73,6 +73,19 @@ void BKE_ffmpeg_context_free(void *context_v);
 
 void BKE_ffmpeg_exit();
 
+/**
+ * Creates a new `libswscale` context, which is multi-threaded when supported by the FFmpeg
+ * version. Unlike #BKE_ffmpeg_sws_get_context it is not cached and can scale between
+ * different sizes. Free it with `sws_freeContext`.
+ */
+SwsContext *BKE_ffmpeg_sws_create_context(int src_width,
+                                          int src_height,
+                                          int av_src_format,
+                                          int dst_width,
+                                          int dst_height,
+                                          int av_dst_format,
+                                          int sws_flags);
+
 /**
  * Gets a `libswscale` context for given size and format parameters.
  * After you're done using the context, call #BKE_ffmpeg_sws_release_context
@@ -255,6 +255,10 @@ struct ArmatureUserdata {
   bPoseChannel **pchan_from_defbase;
   int defbase_len;
 
+  /** Deforming pose channels used for envelope deformation, collected once for all vertices. */
+  const bPoseChannel **pchan_envelope;
+  int pchan_envelope_len;
+
   float premat[4][4];
   float postmat[4][4];
 
@@ -264,6 +268,20 @@ struct ArmatureUserdata {
   } bmesh;
 };
 
+static float armature_envelope_deform(const ArmatureUserdata *data,
+                                      float vec[3],
+                                      DualQuat *dq,
+                                      float mat[3][3],
+                                      const float co[3],
+                                      const bool full_deform)
+{
+  float contrib = 0.0f;
+  for (int i = 0; i < data->pchan_envelope_len; i++) {
+    contrib += dist_bone_deform(data->pchan_envelope[i], vec, dq, mat, co, full_deform);
+  }
+  return contrib;
+}
+
 static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
                                           const int i,
                                           const MDeformVert *dvert)
@@ -360,23 +378,11 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
     }
     /* If there are vertex-groups but not groups with bones (like for soft-body groups). */
     if (deformed == 0 && use_envelope) {
-      for (pchan = static_cast<const bPoseChannel *>(data->ob_arm->pose->chanbase.first); pchan;
-           pchan = pchan->next)
-      {
-        if (!(pchan->bone->flag & BONE_NO_DEFORM)) {
-          contrib += dist_bone_deform(pchan, vec, dq, smat, co, full_deform);
-        }
-      }
+      contrib += armature_envelope_deform(data, vec, dq, smat, co, full_deform);
     }
   }
   else if (use_envelope) {
-    for (pchan = static_cast<const bPoseChannel *>(data->ob_arm->pose->chanbase.first); pchan;
-         pchan = pchan->next)
-    {
-      if (!(pchan->bone->flag & BONE_NO_DEFORM)) {
-        contrib += dist_bone_deform(pchan, vec, dq, smat, co, full_deform);
-      }
-    }
+    contrib += armature_envelope_deform(data, vec, dq, smat, co, full_deform);
   }
 
   /* actually should be EPSILON? weight values and contrib can be like 10e-39 small */
@@ -494,6 +500,8 @@ static void armature_deform_coords_impl(const Object *ob_arm,
 {
   const bArmature *arm = static_cast<const bArmature *>(ob_arm->data);
   bPoseChannel **pchan_from_defbase = nullptr;
+  const bPoseChannel **pchan_envelope = nullptr;
+  int pchan_envelope_len = 0;
   const bool use_envelope = (deformflag & ARM_DEF_ENVELOPE) != 0;
   const bool use_quaternion = (deformflag & ARM_DEF_QUATERNION) != 0;
   const bool invert_vgroup = (deformflag & ARM_DEF_INVERT_VGROUP) != 0;
@@ -577,6 +585,17 @@ static void armature_deform_coords_impl(const Object *ob_arm,
     }
   }
 
+  if (use_envelope) {
+    /* Avoid walking the whole pose channel list for every vertex. */
+    pchan_envelope = static_cast<const bPoseChannel **>(MEM_malloc_arrayN(
+        size_t(BLI_listbase_count(&ob_arm->pose->chanbase)), sizeof(*pchan_envelope), __func__));
+    LISTBASE_FOREACH (const bPoseChannel *, pchan, &ob_arm->pose->chanbase) {
+      if (!(pchan->bone->flag & BONE_NO_DEFORM)) {
+        pchan_envelope[pchan_envelope_len++] = pchan;
+      }
+    }
+  }
+
   ArmatureUserdata data{};
   data.ob_arm = ob_arm;
   data.me_target = me_target;
@@ -592,6 +611,8 @@ static void armature_deform_coords_impl(const Object *ob_arm,
   data.dverts_len = dverts.size();
   data.pchan_from_defbase = pchan_from_defbase;
   data.defbase_len = defbase_len;
+  data.pchan_envelope = pchan_envelope;
+  data.pchan_envelope_len = pchan_envelope_len;
   data.bmesh.cd_dvert_offset = cd_dvert_offset;
 
   float obinv[4][4];
@@ -627,6 +648,9 @@ static void armature_deform_coords_impl(const Object *ob_arm,
   if (pchan_from_defbase) {
     MEM_freeN(pchan_from_defbase);
   }
+  if (pchan_envelope) {
+    MEM_freeN(pchan_envelope);
+  }
 }
 
 void BKE_armature_deform_coords_with_gpencil_stroke(const Object *ob_arm,
@@ -15,6 +15,7 @@
 #include "BLI_endian_defines.h"
 #include "BLI_endian_switch.h"
 #include "BLI_math_matrix_types.hh"
+#include "BLI_mmap.h"
 #include "BLI_path_util.h"
 
 #include "DNA_material_types.h"
@@ -23,10 +24,17 @@
 #include "RNA_access.hh"
 #include "RNA_enum_types.hh"
 
+#include <fcntl.h>
 #include <fmt/format.h>
 #include <sstream>
 #include <xxhash.h>
 
+#ifdef WIN32
+#  include <io.h>
+#else
+#  include <unistd.h>
+#endif
+
 #ifdef WITH_OPENVDB
 #  include <openvdb/io/Stream.h>
 #  include <openvdb/openvdb.h>
@@ -86,6 +94,29 @@ bool BlobReader::read_as_stream(const BlobSlice &slice, FunctionRef<bool(std::is
 
 DiskBlobReader::DiskBlobReader(std::string blobs_dir) : blobs_dir_(std::move(blobs_dir)) {}
 
+DiskBlobReader::~DiskBlobReader()
+{
+  for (BLI_mmap_file *mapped_file : mapped_files_.values()) {
+    if (mapped_file) {
+      BLI_mmap_free(mapped_file);
+    }
+  }
+}
+
+BLI_mmap_file *DiskBlobReader::ensure_mapped_file(const std::string &blob_path) const
+{
+  return mapped_files_.lookup_or_add_cb(blob_path, [&]() -> BLI_mmap_file * {
+    const int file = BLI_open(blob_path.c_str(), O_BINARY | O_RDONLY, 0);
+    if (file == -1) {
+      return nullptr;
+    }
+    /* The mapping stays valid after the file is closed. */
+    BLI_mmap_file *mapped_file = BLI_mmap_open(file);
+    close(file);
+    return mapped_file;
+  });
+}
+
 [[nodiscard]] bool DiskBlobReader::read(const BlobSlice &slice, void *r_data) const
 {
   if (slice.range.is_empty()) {
@@ -95,7 +126,14 @@ DiskBlobReader::DiskBlobReader(std::string blobs_dir) : blobs_dir_(std::move(blo
   char blob_path[FILE_MAX];
   BLI_path_join(blob_path, sizeof(blob_path), blobs_dir_.c_str(), slice.name.c_str());
 
-  std::lock_guard lock{mutex_};
+  std::unique_lock lock{mutex_};
+  if (BLI_mmap_file *mapped_file = this->ensure_mapped_file(blob_path)) {
+    /* Copying from the mapping does not need the lock, so that slices can be read in parallel. */
+    lock.unlock();
+    return BLI_mmap_read(
+        mapped_file, r_data, size_t(slice.range.start()), size_t(slice.range.size()));
+  }
+
   std::unique_ptr<fstream> &blob_file = open_input_streams_.lookup_or_add_cb_as(blob_path, [&]() {
     return std::make_unique<fstream>(blob_path, std::ios::in | std::ios::binary);
   });
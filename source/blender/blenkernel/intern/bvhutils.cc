@@ -11,11 +11,13 @@
 
 #include "BLI_math_geom.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 
 #include "BKE_attribute.hh"
 #include "BKE_bvhutils.hh"
 #include "BKE_editmesh.hh"
 #include "BKE_mesh.hh"
+#include "BKE_pointcloud.hh"
 
 using blender::BitSpan;
 using blender::BitVector;
@@ -31,9 +33,19 @@ using blender::VArray;
 
 struct BVHCacheItem {
   bool is_filled;
+  /** Positions changed since the tree was built, it has to be refit before it is used. */
+  bool needs_refit;
   BVHTree *tree;
+  /** #BLI_bvhtree_get_cost right after building the tree. */
+  float build_cost;
 };
 
+/**
+ * Refit trees are rebuilt once the cost of traversing them grows by this factor compared to the
+ * balanced tree, which happens when elements move a lot relative to each other.
+ */
+static constexpr float bvh_refit_cost_factor_max = 1.5f;
+
 struct BVHCache {
   BVHCacheItem items[BVHTREE_MAX_ITEM];
   ThreadMutex mutex;
@@ -126,9 +138,27 @@ static void bvhcache_insert(BVHCache *bvh_cache, BVHTree *tree, BVHCacheType typ
   BVHCacheItem *item = &bvh_cache->items[type];
   BLI_assert(!item->is_filled);
   item->tree = tree;
+  item->build_cost = tree ? BLI_bvhtree_get_cost(tree) : 0.0f;
   item->is_filled = true;
 }
 
+void bvhcache_tag_positions_changed(BVHCache *bvh_cache)
+{
+  for (int index = 0; index < BVHTREE_MAX_ITEM; index++) {
+    BVHCacheItem *item = &bvh_cache->items[index];
+    /* Leaves of trees built with a mask don't match element indices, so they can't be refit. */
+    if (item->tree && ELEM(index, BVHTREE_FROM_VERTS, BVHTREE_FROM_EDGES, BVHTREE_FROM_CORNER_TRIS))
+    {
+      item->needs_refit = true;
+    }
+    else {
+      BLI_bvhtree_free(item->tree);
+      item->tree = nullptr;
+    }
+    item->is_filled = false;
+  }
+}
+
 void bvhcache_free(BVHCache *bvh_cache)
 {
   for (int index = 0; index < BVHTREE_MAX_ITEM; index++) {
@@ -558,6 +588,12 @@ static BVHTree *bvhtree_new_common(
 /** \name Vertex Builder
  * \{ */
 
+/**
+ * Computing the bounds of leaves is fairly cheap, so only build them in parallel for larger
+ * meshes. The tree itself is then built in parallel by #BLI_bvhtree_balance.
+ */
+static constexpr int leaf_insert_grain_size = 4096;
+
 static BVHTree *bvhtree_from_mesh_verts_create_tree(float epsilon,
                                                     int tree_type,
                                                     int axis,
@@ -570,8 +606,19 @@ static BVHTree *bvhtree_from_mesh_verts_create_tree(float epsilon,
     return nullptr;
   }
 
+  if (verts_mask.is_empty()) {
+    const int first_leaf = BLI_bvhtree_insert_range(tree, positions.size());
+    blender::threading::parallel_for(
+        positions.index_range(), leaf_insert_grain_size, [&](const IndexRange range) {
+          for (const int i : range) {
+            BLI_bvhtree_insert_at(tree, first_leaf + i, i, positions[i], 1);
+          }
+        });
+    return tree;
+  }
+
   for (const int i : positions.index_range()) {
-    if (!verts_mask.is_empty() && !verts_mask[i]) {
+    if (!verts_mask[i]) {
       continue;
     }
     BLI_bvhtree_insert(tree, i, positions[i], 1);
@@ -621,8 +668,22 @@ static BVHTree *bvhtree_from_mesh_edges_create_tree(const Span<float3> positions
     return nullptr;
   }
 
+  if (edges_mask.is_empty()) {
+    const int first_leaf = BLI_bvhtree_insert_range(tree, edges.size());
+    blender::threading::parallel_for(
+        edges.index_range(), leaf_insert_grain_size, [&](const IndexRange range) {
+          for (const int i : range) {
+            float co[2][3];
+            copy_v3_v3(co[0], positions[edges[i][0]]);
+            copy_v3_v3(co[1], positions[edges[i][1]]);
+            BLI_bvhtree_insert_at(tree, first_leaf + i, i, co[0], 2);
+          }
+        });
+    return tree;
+  }
+
   for (const int i : edges.index_range()) {
-    if (!edges_mask.is_empty() && !edges_mask[i]) {
+    if (!edges_mask[i]) {
       continue;
     }
     float co[2][3];
@@ -726,9 +787,24 @@ static BVHTree *bvhtree_from_mesh_corner_tris_create_tree(float epsilon,
     return nullptr;
   }
 
+  if (corner_tris_mask.is_empty()) {
+    const int first_leaf = BLI_bvhtree_insert_range(tree, corner_tris.size());
+    blender::threading::parallel_for(
+        corner_tris.index_range(), leaf_insert_grain_size, [&](const IndexRange range) {
+          for (const int i : range) {
+            float co[3][3];
+            copy_v3_v3(co[0], positions[corner_verts[corner_tris[i][0]]]);
+            copy_v3_v3(co[1], positions[corner_verts[corner_tris[i][1]]]);
+            copy_v3_v3(co[2], positions[corner_verts[corner_tris[i][2]]]);
+            BLI_bvhtree_insert_at(tree, first_leaf + i, i, co[0], 3);
+          }
+        });
+    return tree;
+  }
+
   for (const int i : corner_tris.index_range()) {
     float co[3][3];
-    if (!corner_tris_mask.is_empty() && !corner_tris_mask[i]) {
+    if (!corner_tris_mask[i]) {
       continue;
     }
 
@@ -812,6 +888,71 @@ static BitVector<> corner_tris_no_hidden_map_get(const blender::OffsetIndices<in
   return corner_tris_mask;
 }
 
+/**
+ * Update the bounds of a tree built from all elements of the given type to new positions, which
+ * is much cheaper than building a new tree.
+ * \return False when the tree should be rebuilt instead because its quality degraded too much.
+ */
+static bool bvhtree_refit(BVHTree *tree,
+                          const float build_cost,
+                          const BVHCacheType bvh_cache_type,
+                          const Span<float3> positions,
+                          const Span<blender::int2> edges,
+                          const Span<int> corner_verts,
+                          const Span<int3> corner_tris)
+{
+  using namespace blender;
+  switch (bvh_cache_type) {
+    case BVHTREE_FROM_VERTS: {
+      if (BLI_bvhtree_get_len(tree) != positions.size()) {
+        return false;
+      }
+      threading::parallel_for(
+          positions.index_range(), leaf_insert_grain_size, [&](const IndexRange range) {
+            for (const int i : range) {
+              BLI_bvhtree_update_node(tree, i, positions[i], nullptr, 1);
+            }
+          });
+      break;
+    }
+    case BVHTREE_FROM_EDGES: {
+      if (BLI_bvhtree_get_len(tree) != edges.size()) {
+        return false;
+      }
+      threading::parallel_for(
+          edges.index_range(), leaf_insert_grain_size, [&](const IndexRange range) {
+            for (const int i : range) {
+              float co[2][3];
+              copy_v3_v3(co[0], positions[edges[i][0]]);
+              copy_v3_v3(co[1], positions[edges[i][1]]);
+              BLI_bvhtree_update_node(tree, i, co[0], nullptr, 2);
+            }
+          });
+      break;
+    }
+    case BVHTREE_FROM_CORNER_TRIS: {
+      if (BLI_bvhtree_get_len(tree) != corner_tris.size()) {
+        return false;
+      }
+      threading::parallel_for(
+          corner_tris.index_range(), leaf_insert_grain_size, [&](const IndexRange range) {
+            for (const int i : range) {
+              float co[3][3];
+              copy_v3_v3(co[0], positions[corner_verts[corner_tris[i][0]]]);
+              copy_v3_v3(co[1], positions[corner_verts[corner_tris[i][1]]]);
+              copy_v3_v3(co[2], positions[corner_verts[corner_tris[i][2]]]);
+              BLI_bvhtree_update_node(tree, i, co[0], nullptr, 3);
+            }
+          });
+      break;
+    }
+    default:
+      return false;
+  }
+  BLI_bvhtree_update_tree(tree);
+  return BLI_bvhtree_get_cost(tree) <= build_cost * bvh_refit_cost_factor_max;
+}
+
 BVHTree *BKE_bvhtree_from_mesh_get(BVHTreeFromMesh *data,
                                    const Mesh *mesh,
                                    const BVHCacheType bvh_cache_type,
@@ -851,6 +992,25 @@ BVHTree *BKE_bvhtree_from_mesh_get(BVHTreeFromMesh *data,
     return data->tree;
   }
 
+  BVHCacheItem &item = (*bvh_cache_p)->items[bvh_cache_type];
+  if (item.needs_refit) {
+    item.needs_refit = false;
+    bool refit_success = false;
+    threading::isolate_task([&]() {
+      refit_success = bvhtree_refit(
+          item.tree, item.build_cost, bvh_cache_type, positions, edges, corner_verts, corner_tris);
+    });
+    if (refit_success) {
+      data->tree = item.tree;
+      data->cached = true;
+      item.is_filled = true;
+      bvhcache_unlock(*bvh_cache_p, lock_started);
+      return data->tree;
+    }
+    BLI_bvhtree_free(item.tree);
+    item.tree = nullptr;
+  }
+
   /* Create BVHTree. */
 
   switch (bvh_cache_type) {
@@ -1074,30 +1234,57 @@ void free_bvhtree_from_mesh(BVHTreeFromMesh *data)
 /** \name Point Cloud BVH Building
  * \{ */
 
-void BKE_bvhtree_from_pointcloud_get(const PointCloud &pointcloud,
-                                     const blender::IndexMask &points_mask,
-                                     BVHTreeFromPointCloud &r_data)
+namespace blender::bke {
+
+void BVHTreeDeleter::operator()(BVHTree *tree)
+{
+  BLI_bvhtree_free(tree);
+}
+
+}  // namespace blender::bke
+
+static BVHTree *bvhtree_from_pointcloud_create_tree(const Span<float3> positions,
+                                                    const blender::IndexMask &points_mask)
 {
   int active_num = -1;
   BVHTree *tree = bvhtree_new_common(0.0f, 2, 6, points_mask.size(), active_num);
-  r_data.tree = tree;
   if (!tree) {
-    return;
+    return nullptr;
   }
 
-  const Span<float3> positions = pointcloud.positions();
   points_mask.foreach_index([&](const int i) { BLI_bvhtree_insert(tree, i, positions[i], 1); });
 
   BLI_bvhtree_balance(tree);
+  return tree;
+}
+
+void BKE_bvhtree_from_pointcloud_get(const PointCloud &pointcloud,
+                                     const blender::IndexMask &points_mask,
+                                     BVHTreeFromPointCloud &r_data)
+{
+  const Span<float3> positions = pointcloud.positions();
 
   r_data.coords = (const float(*)[3])positions.data();
-  r_data.tree = tree;
   r_data.nearest_callback = nullptr;
+
+  if (points_mask.size() == pointcloud.totpoint) {
+    /* Can use cache if all points are in the bvh tree. */
+    pointcloud.runtime->bvh_cache.ensure(
+        [&](std::unique_ptr<BVHTree, blender::bke::BVHTreeDeleter> &r_tree) {
+          r_tree.reset(bvhtree_from_pointcloud_create_tree(positions, points_mask));
+        });
+    r_data.tree = pointcloud.runtime->bvh_cache.data().get();
+    r_data.cached = true;
+    return;
+  }
+
+  r_data.tree = bvhtree_from_pointcloud_create_tree(positions, points_mask);
+  r_data.cached = false;
 }
 
 void free_bvhtree_from_pointcloud(BVHTreeFromPointCloud *data)
 {
-  if (data->tree) {
+  if (data->tree && !data->cached) {
     BLI_bvhtree_free(data->tree);
   }
   memset(data, 0, sizeof(*data));
@@ -839,23 +839,6 @@ Mesh *curve_to_mesh_sweep(const CurvesGeometry &main,
                        face_offsets);
   });
 
-  if (fill_caps) {
-    /* TODO: This is used to keep the tests passing after refactoring mesh shade smooth flags. It
-     * can be removed if the tests are updated and the final shading results will be the same. */
-    SpanAttributeWriter<bool> sharp_faces = mesh_attributes.lookup_or_add_for_write_span<bool>(
-        "sharp_face", AttrDomain::Face);
-    foreach_curve_combination(curves_info, offsets, [&](const CombinationInfo &info) {
-      const bool has_caps = fill_caps && !info.main_cyclic && info.profile_cyclic;
-      if (has_caps) {
-        const int face_num = info.main_segment_num * info.profile_segment_num;
-        const int cap_face_offset = info.face_range.start() + face_num;
-        sharp_faces.span[cap_face_offset] = true;
-        sharp_faces.span[cap_face_offset + 1] = true;
-      }
-    });
-    sharp_faces.finish();
-  }
-
   Vector<std::byte> eval_buffer;
 
   /* Make sure curve attributes can be interpolated. */
@@ -880,10 +863,21 @@ Mesh *curve_to_mesh_sweep(const CurvesGeometry &main,
       sharp_edges = mesh_attributes.lookup_or_add_for_write_span<bool>("sharp_edge",
                                                                        AttrDomain::Edge);
     }
+    /* TODO: Sharp cap faces are used to keep the tests passing after refactoring mesh shade
+     * smooth flags. They can be removed if the tests are updated and the final shading results
+     * will be the same. */
+    SpanAttributeWriter<bool> sharp_faces = mesh_attributes.lookup_or_add_for_write_span<bool>(
+        "sharp_face", AttrDomain::Face);
+    /* Write the cap face and edge flags in a single pass over the combinations. */
     foreach_curve_combination(curves_info, offsets, [&](const CombinationInfo &info) {
       if (info.main_cyclic || !info.profile_cyclic) {
         return;
       }
+      const int face_num = info.main_segment_num * info.profile_segment_num;
+      const int cap_face_offset = info.face_range.start() + face_num;
+      sharp_faces.span[cap_face_offset] = true;
+      sharp_faces.span[cap_face_offset + 1] = true;
+
       const int main_edges_start = info.edge_range.start();
       const int last_ring_index = info.main_points.size() - 1;
       const int profile_edges_start = main_edges_start +
@@ -894,6 +888,7 @@ Mesh *curve_to_mesh_sweep(const CurvesGeometry &main,
       sharp_edges.span.slice(profile_edges_start, info.profile_segment_num).fill(true);
       sharp_edges.span.slice(last_ring_edge_offset, info.profile_segment_num).fill(true);
     });
+    sharp_faces.finish();
   }
   sharp_edges.finish();
 
@@ -632,6 +632,7 @@ void CurvesGeometry::ensure_nurbs_basis_cache() const
 
     nurbs_mask.foreach_segment(GrainSize(64), [&](const IndexMaskSegment segment) {
       Vector<float, 32> knots;
+      int prev_curve_index = -1;
       for (const int curve_index : segment) {
         const IndexRange points = points_by_curve[curve_index];
         const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
@@ -645,6 +646,19 @@ void CurvesGeometry::ensure_nurbs_basis_cache() const
           continue;
         }
 
+        /* The basis only depends on these values, so it can be copied from the previous curve
+         * when they match. That is common when many curves are generated the same way. */
+        if (prev_curve_index != -1 &&
+            points_by_curve[prev_curve_index].size() == points.size() &&
+            evaluated_points_by_curve[prev_curve_index].size() == evaluated_points.size() &&
+            orders[prev_curve_index] == order && cyclic[prev_curve_index] == is_cyclic &&
+            knots_modes[prev_curve_index] == int8_t(mode))
+        {
+          r_data[curve_index] = r_data[prev_curve_index];
+          continue;
+        }
+        prev_curve_index = curve_index;
+
         knots.reinitialize(curves::nurbs::knots_num(points.size(), order, is_cyclic));
         curves::nurbs::calculate_knots(points.size(), mode, order, is_cyclic, knots);
         curves::nurbs::calculate_basis_cache(
@@ -3343,7 +3343,9 @@ bool CustomData_free_layer(CustomData *data,
     }
   }
 
-  if (data->totlayer <= data->maxlayer - CUSTOMDATA_GROW) {
+  /* Only shrink when there is more than one step of unused layers, otherwise alternately adding
+   * and removing a layer (common for temporary attributes) reallocates the array every time. */
+  if (data->totlayer <= data->maxlayer - 2 * CUSTOMDATA_GROW) {
     customData_resize(data, -CUSTOMDATA_GROW);
   }
 
@@ -18,6 +18,7 @@
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.hh"
@@ -931,6 +932,10 @@ static void key_evaluate_relative(const int start,
         poin += start * poinsize;
         reffrom += key->elemsize * start; /* key elemsize yes! */
         from += key->elemsize * start;
+        if (weights) {
+          /* Weights are only used for meshes and lattices, with one element per step. */
+          weights += start;
+        }
 
         for (b = start; b < end; b += step) {
 
@@ -945,35 +950,38 @@ static void key_evaluate_relative(const int start,
 
           while (cp[0]) { /* (cp[0] == amount) */
 
-            switch (cp[1]) {
-              case IPO_FLOAT:
-                rel_flerp(KEYELEM_FLOAT_LEN_COORD,
-                          (float *)poin,
-                          (float *)reffrom,
-                          (float *)from,
-                          weight);
-                break;
-              case IPO_BPOINT:
-                rel_flerp(KEYELEM_FLOAT_LEN_BPOINT,
-                          (float *)poin,
-                          (float *)reffrom,
-                          (float *)from,
-                          weight);
-                break;
-              case IPO_BEZTRIPLE:
-                rel_flerp(KEYELEM_FLOAT_LEN_BEZTRIPLE,
-                          (float *)poin,
-                          (float *)reffrom,
-                          (float *)from,
-                          weight);
-                break;
-              default:
-                /* should never happen */
-                if (freefrom) {
-                  MEM_freeN(freefrom);
-                }
-                BLI_assert_msg(0, "invalid 'cp[1]'");
-                return;
+            /* Shape keys often only affect a small region, skip elements outside of it. */
+            if (weight != 0.0f) {
+              switch (cp[1]) {
+                case IPO_FLOAT:
+                  rel_flerp(KEYELEM_FLOAT_LEN_COORD,
+                            (float *)poin,
+                            (float *)reffrom,
+                            (float *)from,
+                            weight);
+                  break;
+                case IPO_BPOINT:
+                  rel_flerp(KEYELEM_FLOAT_LEN_BPOINT,
+                            (float *)poin,
+                            (float *)reffrom,
+                            (float *)from,
+                            weight);
+                  break;
+                case IPO_BEZTRIPLE:
+                  rel_flerp(KEYELEM_FLOAT_LEN_BEZTRIPLE,
+                            (float *)poin,
+                            (float *)reffrom,
+                            (float *)from,
+                            weight);
+                  break;
+                default:
+                  /* should never happen */
+                  if (freefrom) {
+                    MEM_freeN(freefrom);
+                  }
+                  BLI_assert_msg(0, "invalid 'cp[1]'");
+                  return;
+              }
             }
 
             poin += *ofsp;
@@ -1397,8 +1405,26 @@ static void do_mesh_key(Object *ob, Key *key, char *out, const int tot)
     WeightsArrayCache cache = {0, nullptr};
     float **per_keyblock_weights;
     per_keyblock_weights = keyblock_get_per_block_weights(ob, key, &cache);
-    key_evaluate_relative(
-        0, tot, tot, (char *)out, key, actkb, per_keyblock_weights, KEY_MODE_DUMMY);
+    const Mesh *mesh = reinterpret_cast<const Mesh *>(key->from);
+    if (mesh != nullptr && mesh->runtime->edit_mesh == nullptr) {
+      /* Vertices are independent, blend ranges of them in parallel. In edit mode the active key
+       * is read from the #BMesh which would be copied for every range. */
+      blender::threading::parallel_for(
+          blender::IndexRange(tot), 4096, [&](const blender::IndexRange range) {
+            key_evaluate_relative(range.first(),
+                                  range.one_after_last(),
+                                  tot,
+                                  out,
+                                  key,
+                                  actkb,
+                                  per_keyblock_weights,
+                                  KEY_MODE_DUMMY);
+          });
+    }
+    else {
+      key_evaluate_relative(
+          0, tot, tot, (char *)out, key, actkb, per_keyblock_weights, KEY_MODE_DUMMY);
+    }
     keyblock_free_per_block_weights(key, per_keyblock_weights, &cache);
   }
   else {
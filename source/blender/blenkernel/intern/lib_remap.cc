@@ -552,7 +552,11 @@ static void libblock_remap_data(
   });
 }
 
-static void libblock_remap_foreach_idpair(ID *old_id, ID *new_id, Main *bmain, int remap_flags)
+static void libblock_remap_foreach_idpair(ID *old_id,
+                                          ID *new_id,
+                                          Main *bmain,
+                                          int remap_flags,
+                                          bool &is_object_collection_sync_processed)
 {
   if (old_id == new_id) {
     return;
@@ -603,8 +607,11 @@ static void libblock_remap_foreach_idpair(ID *old_id, ID *new_id, Main *bmain, i
    * Maybe we should do a per-ID callback for this instead? */
   switch (GS(old_id->name)) {
     case ID_OB:
+      /* All remapping is already done at this point, so syncing the collections once is enough
+       * when many objects are remapped (or deleted) together. */
       libblock_remap_data_postprocess_object_update(
-          bmain, (Object *)old_id, (Object *)new_id, true);
+          bmain, (Object *)old_id, (Object *)new_id, !is_object_collection_sync_processed);
+      is_object_collection_sync_processed = true;
       break;
     case ID_GR:
       libblock_remap_data_postprocess_collection_update(
@@ -651,8 +658,10 @@ void BKE_libblock_remap_multiple_locked(Main *bmain, IDRemapper &mappings, const
 
   libblock_remap_data(bmain, nullptr, ID_REMAP_TYPE_REMAP, mappings, remap_flags);
 
+  bool is_object_collection_sync_processed = false;
   mappings.iter([&](ID *old_id, ID *new_id) {
-    libblock_remap_foreach_idpair(old_id, new_id, bmain, remap_flags);
+    libblock_remap_foreach_idpair(
+        old_id, new_id, bmain, remap_flags, is_object_collection_sync_processed);
   });
 
   /* We assume editors do not hold references to their IDs... This is false in some cases
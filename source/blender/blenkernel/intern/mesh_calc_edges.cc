@@ -88,18 +88,23 @@ static void add_face_edges_to_hash_maps(const Mesh &mesh,
   });
 }
 
-static void serialize_and_initialize_deduplicated_edges(MutableSpan<EdgeMap> edge_maps,
-                                                        MutableSpan<int2> new_edges)
+static OffsetIndices<int> calc_edge_offsets(const Span<EdgeMap> edge_maps,
+                                           MutableSpan<int> r_sizes)
 {
   /* All edges are distributed in the hash tables now. They have to be serialized into a single
    * array below. To be able to parallelize this, we have to compute edge index offsets for each
    * map. */
-  Array<int> edge_sizes(edge_maps.size() + 1);
   for (const int i : edge_maps.index_range()) {
-    edge_sizes[i] = edge_maps[i].size();
+    r_sizes[i] = edge_maps[i].size();
   }
-  const OffsetIndices<int> edge_offsets = offset_indices::accumulate_counts_to_offsets(edge_sizes);
+  return offset_indices::accumulate_counts_to_offsets(r_sizes);
+}
 
+static void serialize_and_initialize_deduplicated_edges(MutableSpan<EdgeMap> edge_maps,
+                                                        const OffsetIndices<int> edge_offsets,
+                                                        MutableSpan<int2> new_edges,
+                                                        MutableSpan<bool> select_new_edges)
+{
   threading::parallel_for_each(edge_maps, [&](EdgeMap &edge_map) {
     const int task_index = &edge_map - edge_maps.data();
 
@@ -115,6 +120,10 @@ static void serialize_and_initialize_deduplicated_edges(MutableSpan<EdgeMap> edg
         /* Initialize new edge. */
         new_edge = int2(item.key.v_low, item.key.v_high);
       }
+      if (!select_new_edges.is_empty()) {
+        select_new_edges[new_edge_index] = orig_edge == nullptr;
+      }
+      /* This overwrites the original edge pointer, it can't be accessed afterwards. */
       item.value.index = new_edge_index;
       new_edge_index++;
     }
@@ -189,16 +198,20 @@ void mesh_calc_edges(Mesh &mesh, bool keep_existing_edges, const bool select_new
   calc_edges::add_face_edges_to_hash_maps(mesh, parallel_mask, edge_maps);
 
   /* Compute total number of edges. */
-  int new_totedge = 0;
-  for (const calc_edges::EdgeMap &edge_map : edge_maps) {
-    new_totedge += edge_map.size();
-  }
+  Array<int> edge_sizes(parallel_maps + 1);
+  const OffsetIndices<int> edge_offsets = calc_edges::calc_edge_offsets(edge_maps, edge_sizes);
+  const int new_totedge = edge_offsets.total_size();
 
   /* Create new edges. */
   MutableAttributeAccessor attributes = mesh.attributes_for_write();
   attributes.add<int>(".corner_edge", AttrDomain::Corner, AttributeInitConstruct());
   MutableSpan<int2> new_edges(MEM_cnew_array<int2>(new_totedge, __func__), new_totedge);
-  calc_edges::serialize_and_initialize_deduplicated_edges(edge_maps, new_edges);
+  MutableSpan<bool> select_edge;
+  if (select_new_edges) {
+    select_edge = {MEM_cnew_array<bool>(new_totedge, __func__), new_totedge};
+  }
+  calc_edges::serialize_and_initialize_deduplicated_edges(
+      edge_maps, edge_offsets, new_edges, select_edge);
   calc_edges::update_edge_indices_in_face_loops(
       mesh.faces(), mesh.corner_verts(), edge_maps, parallel_mask, mesh.corner_edges_for_write());
 
@@ -209,21 +222,8 @@ void mesh_calc_edges(Mesh &mesh, bool keep_existing_edges, const bool select_new
   attributes.add<int2>(".edge_verts", AttrDomain::Edge, AttributeInitMoveArray(new_edges.data()));
 
   if (select_new_edges) {
-    MutableAttributeAccessor attributes = mesh.attributes_for_write();
-    SpanAttributeWriter<bool> select_edge = attributes.lookup_or_add_for_write_span<bool>(
-        ".select_edge", AttrDomain::Edge);
-    if (select_edge) {
-      int new_edge_index = 0;
-      for (const calc_edges::EdgeMap &edge_map : edge_maps) {
-        for (const calc_edges::EdgeMap::Item item : edge_map.items()) {
-          if (item.value.original_edge == nullptr) {
-            select_edge.span[new_edge_index] = true;
-          }
-          new_edge_index++;
-        }
-      }
-      select_edge.finish();
-    }
+    attributes.add<bool>(
+        ".select_edge", AttrDomain::Edge, AttributeInitMoveArray(select_edge.data()));
   }
 
   if (!keep_existing_edges) {
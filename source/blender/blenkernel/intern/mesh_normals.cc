@@ -10,6 +10,7 @@
  * \see `bmesh_mesh_normals.cc` for the equivalent #BMesh functionality.
  */
 
+#include <atomic>
 #include <climits>
 
 #include "MEM_guardedalloc.h"
@@ -17,6 +18,7 @@
 #include "BLI_math_geom.h"
 #include "BLI_math_vector.h"
 
+#include "BLI_array.hh"
 #include "BLI_array_utils.hh"
 #include "BLI_bit_vector.hh"
 #include "BLI_linklist.h"
@@ -1082,9 +1084,9 @@ static bool corner_split_generator_check_cyclic_smooth_fan(const Span<int> corne
   }
 }
 
-static void corner_split_generator(CornerSplitTaskDataCommon *common_data,
-                                   Vector<int, 32> &r_single_corners,
-                                   Vector<int, 32> &r_fan_corners)
+static void corner_split_generator_serial(CornerSplitTaskDataCommon *common_data,
+                                          Vector<int, 32> &r_single_corners,
+                                          Vector<int, 32> &r_fan_corners)
 {
   const Span<int> corner_verts = common_data->corner_verts;
   const Span<int> corner_edges = common_data->corner_edges;
@@ -1163,6 +1165,126 @@ static void corner_split_generator(CornerSplitTaskDataCommon *common_data,
   }
 }
 
+/**
+ * Longest smooth fan walked when classifying corners in parallel. Longer walks are either very
+ * high valence vertices or degenerate topology where the walk never gets back to its start corner,
+ * both are handled by #corner_split_generator_serial.
+ */
+static constexpr int fan_walk_steps_max = 1024;
+
+enum class CornerSplitType : int8_t {
+  None,
+  Single,
+  Fan,
+};
+
+/**
+ * Thread-safe variant of #corner_split_generator_check_cyclic_smooth_fan that doesn't depend on
+ * corners tagged by previous walks. A corner starts a cyclic smooth fan when it has the smallest
+ * index of all corners in that fan, which is the corner the serial version finds first.
+ *
+ * \return False when the walk exceeded #fan_walk_steps_max.
+ */
+static bool corner_is_cyclic_smooth_fan_start(const Span<int> corner_verts,
+                                              const Span<int> corner_edges,
+                                              const OffsetIndices<int> faces,
+                                              const Span<int2> edge_to_corners,
+                                              const Span<int> corner_to_face,
+                                              const int corner,
+                                              const int corner_prev,
+                                              bool &r_is_start)
+{
+  const int vert_pivot = corner_verts[corner];
+  int2 e2lfan_curr = edge_to_corners[corner_edges[corner_prev]];
+  int fan_corner = corner_prev;
+  int vert_corner = corner;
+  r_is_start = false;
+  for (int step = 0; step < fan_walk_steps_max; step++) {
+    if (IS_EDGE_SHARP(e2lfan_curr)) {
+      return true;
+    }
+    corner_manifold_fan_around_vert_next(
+        corner_verts, faces, corner_to_face, e2lfan_curr, vert_pivot, &fan_corner, &vert_corner);
+    e2lfan_curr = edge_to_corners[corner_edges[fan_corner]];
+    if (IS_EDGE_SHARP(e2lfan_curr)) {
+      return true;
+    }
+    if (vert_corner == corner) {
+      r_is_start = true;
+      return true;
+    }
+    if (vert_corner < corner) {
+      /* The fan is started by a corner processed before this one. */
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Find the corners that start the computation of a smooth fan, or just use their face normal.
+ * The classification of every corner is independent, so it is done in parallel, the result is
+ * gathered in corner order to give the same result as #corner_split_generator_serial.
+ */
+static void corner_split_generator(CornerSplitTaskDataCommon *common_data,
+                                   Vector<int, 32> &r_single_corners,
+                                   Vector<int, 32> &r_fan_corners)
+{
+  const Span<int> corner_verts = common_data->corner_verts;
+  const Span<int> corner_edges = common_data->corner_edges;
+  const OffsetIndices faces = common_data->faces;
+  const Span<int> corner_to_face = common_data->corner_to_face;
+  const Span<int2> edge_to_corners = common_data->edge_to_corners;
+
+  Array<CornerSplitType> corner_types(corner_verts.size());
+  std::atomic<bool> walk_failed = false;
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int face_index : range) {
+      const IndexRange face = faces[face_index];
+      for (const int corner : face) {
+        const int corner_prev = mesh::face_corner_prev(face, corner);
+        const bool sharp_prev = IS_EDGE_SHARP(edge_to_corners[corner_edges[corner_prev]]);
+        if (IS_EDGE_SHARP(edge_to_corners[corner_edges[corner]])) {
+          corner_types[corner] = sharp_prev ? CornerSplitType::Single : CornerSplitType::Fan;
+          continue;
+        }
+        bool is_start;
+        if (!corner_is_cyclic_smooth_fan_start(corner_verts,
+                                               corner_edges,
+                                               faces,
+                                               edge_to_corners,
+                                               corner_to_face,
+                                               corner,
+                                               corner_prev,
+                                               is_start))
+        {
+          walk_failed.store(true, std::memory_order_relaxed);
+          return;
+        }
+        corner_types[corner] = is_start ? CornerSplitType::Fan : CornerSplitType::None;
+      }
+    }
+  });
+
+  if (walk_failed) {
+    corner_split_generator_serial(common_data, r_single_corners, r_fan_corners);
+    return;
+  }
+
+  for (const int corner : corner_types.index_range()) {
+    switch (corner_types[corner]) {
+      case CornerSplitType::None:
+        break;
+      case CornerSplitType::Single:
+        r_single_corners.append(corner);
+        break;
+      case CornerSplitType::Fan:
+        r_fan_corners.append(corner);
+        break;
+    }
+  }
+}
+
 void normals_calc_corners(const Span<float3> vert_positions,
                           const Span<int2> edges,
                           const OffsetIndices<int> faces,
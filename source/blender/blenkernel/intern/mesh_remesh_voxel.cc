@@ -170,31 +170,62 @@ Mesh *BKE_mesh_remesh_quadriflow(const Mesh *mesh,
 }
 
 #ifdef WITH_OPENVDB
-static openvdb::FloatGrid::Ptr remesh_voxel_level_set_create(const Mesh *mesh,
-                                                             const float voxel_size)
-{
-  const Span<float3> positions = mesh->vert_positions();
-  const Span<int> corner_verts = mesh->corner_verts();
-  const Span<int3> corner_tris = mesh->corner_tris();
+/**
+ * Reads the triangulated mesh directly, following the `MeshDataAdapter` interface from OpenVDB.
+ * This avoids copying the positions and triangles into temporary arrays first.
+ */
+class RemeshMeshAdapter {
+  Span<float3> positions_;
+  Span<int> corner_verts_;
+  Span<int3> corner_tris_;
+  float world_to_index_;
+
+ public:
+  RemeshMeshAdapter(const Span<float3> positions,
+                    const Span<int> corner_verts,
+                    const Span<int3> corner_tris,
+                    const float voxel_size)
+      : positions_(positions),
+        corner_verts_(corner_verts),
+        corner_tris_(corner_tris),
+        world_to_index_(1.0f / voxel_size)
+  {
+  }
+
+  size_t polygonCount() const
+  {
+    return size_t(corner_tris_.size());
+  }
 
-  std::vector<openvdb::Vec3s> points(mesh->verts_num);
-  std::vector<openvdb::Vec3I> triangles(corner_tris.size());
+  size_t pointCount() const
+  {
+    return size_t(positions_.size());
+  }
 
-  for (const int i : IndexRange(mesh->verts_num)) {
-    const float3 &co = positions[i];
-    points[i] = openvdb::Vec3s(co.x, co.y, co.z);
+  size_t vertexCount(size_t /*polygon_index*/) const
+  {
+    return 3;
   }
 
-  for (const int i : IndexRange(corner_tris.size())) {
-    const int3 &tri = corner_tris[i];
-    triangles[i] = openvdb::Vec3I(
-        corner_verts[tri[0]], corner_verts[tri[1]], corner_verts[tri[2]]);
+  void getIndexSpacePoint(size_t polygon_index, size_t vertex_index, openvdb::Vec3d &pos) const
+  {
+    const int3 &tri = corner_tris_[polygon_index];
+    const float3 co = positions_[corner_verts_[tri[vertex_index]]] * world_to_index_;
+    pos = openvdb::Vec3d(co.x, co.y, co.z);
   }
+};
+
+static openvdb::FloatGrid::Ptr remesh_voxel_level_set_create(const Mesh *mesh,
+                                                             const float voxel_size)
+{
+  const RemeshMeshAdapter adapter(
+      mesh->vert_positions(), mesh->corner_verts(), mesh->corner_tris(), voxel_size);
 
   openvdb::math::Transform::Ptr transform = openvdb::math::Transform::createLinearTransform(
       voxel_size);
-  openvdb::FloatGrid::Ptr grid = openvdb::tools::meshToLevelSet<openvdb::FloatGrid>(
-      *transform, points, triangles, 1.0f);
+  /* Same as #openvdb::tools::meshToLevelSet with a half width of one voxel. */
+  openvdb::FloatGrid::Ptr grid = openvdb::tools::meshToVolume<openvdb::FloatGrid>(
+      adapter, *transform, 1.0f, 1.0f);
 
   return grid;
 }
@@ -225,24 +256,30 @@ static Mesh *remesh_voxel_volume_to_mesh(const openvdb::FloatGrid::Ptr level_set
         3, triangle_loop_start, face_offsets.drop_front(quads.size()));
   }
 
-  for (const int i : vert_positions.index_range()) {
-    vert_positions[i] = float3(vertices[i].x(), vertices[i].y(), vertices[i].z());
-  }
+  threading::parallel_for(vert_positions.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      vert_positions[i] = float3(vertices[i].x(), vertices[i].y(), vertices[i].z());
+    }
+  });
 
-  for (const int i : IndexRange(quads.size())) {
-    const int loopstart = i * 4;
-    mesh_corner_verts[loopstart] = quads[i][0];
-    mesh_corner_verts[loopstart + 1] = quads[i][3];
-    mesh_corner_verts[loopstart + 2] = quads[i][2];
-    mesh_corner_verts[loopstart + 3] = quads[i][1];
-  }
+  threading::parallel_for(IndexRange(quads.size()), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      const int loopstart = i * 4;
+      mesh_corner_verts[loopstart] = quads[i][0];
+      mesh_corner_verts[loopstart + 1] = quads[i][3];
+      mesh_corner_verts[loopstart + 2] = quads[i][2];
+      mesh_corner_verts[loopstart + 3] = quads[i][1];
+    }
+  });
 
-  for (const int i : IndexRange(tris.size())) {
-    const int loopstart = triangle_loop_start + i * 3;
-    mesh_corner_verts[loopstart] = tris[i][2];
-    mesh_corner_verts[loopstart + 1] = tris[i][1];
-    mesh_corner_verts[loopstart + 2] = tris[i][0];
-  }
+  threading::parallel_for(IndexRange(tris.size()), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      const int loopstart = triangle_loop_start + i * 3;
+      mesh_corner_verts[loopstart] = tris[i][2];
+      mesh_corner_verts[loopstart + 1] = tris[i][1];
+      mesh_corner_verts[loopstart + 2] = tris[i][0];
+    }
+  });
 
   mesh_calc_edges(*mesh, false, false);
 
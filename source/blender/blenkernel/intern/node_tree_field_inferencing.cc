@@ -102,10 +102,33 @@ static const FieldInferencingInterface &get_dummy_field_inferencing_interface(co
   return inferencing_interface;
 }
 
+/**
+ * The cached interface is built from the socket declarations, so it can only be used when the
+ * node's sockets match them. That's not the case when updating the sockets was skipped for example.
+ */
+static bool sockets_match_declaration(const bNode &node, const NodeDeclaration &node_decl)
+{
+  const Span<const bNodeSocket *> inputs = node.input_sockets();
+  const Span<const bNodeSocket *> outputs = node.output_sockets();
+  if (inputs.size() != node_decl.inputs.size() || outputs.size() != node_decl.outputs.size()) {
+    return false;
+  }
+  for (const int i : inputs.index_range()) {
+    if (inputs[i]->typeinfo->type != node_decl.inputs[i]->socket_type) {
+      return false;
+    }
+  }
+  for (const int i : outputs.index_range()) {
+    if (outputs[i]->typeinfo->type != node_decl.outputs[i]->socket_type) {
+      return false;
+    }
+  }
+  return true;
+}
+
 /**
  * Retrieves information about how the node interacts with fields.
- * In the future, this information can be stored in the node declaration. This would allow this
- * function to return a reference, making it more efficient.
+ * For most nodes this is stored in the node declaration, so no new interface has to be built.
  */
 static const FieldInferencingInterface &get_node_field_inferencing_interface(const bNode &node,
                                                                              ResourceScope &scope)
@@ -128,6 +151,17 @@ static const FieldInferencingInterface &get_node_field_inferencing_interface(con
     return *group->runtime->field_inferencing_interface;
   }
 
+  if (!ELEM(node.type, NODE_REROUTE, NODE_GROUP_INPUT, NODE_GROUP_OUTPUT, NODE_CUSTOM) &&
+      node.typeinfo != &blender::bke::NodeTypeUndefined)
+  {
+    if (const NodeDeclaration *node_decl = node.declaration()) {
+      const FieldInferencingInterface *cached_interface = node_decl->field_inferencing_interface();
+      if (cached_interface && sockets_match_declaration(node, *node_decl)) {
+        return *cached_interface;
+      }
+    }
+  }
+
   auto &inferencing_interface = scope.construct<FieldInferencingInterface>();
   for (const bNodeSocket *input_socket : node.input_sockets()) {
     inferencing_interface.inputs.append(get_interface_input_field_type(node, *input_socket));
@@ -228,15 +228,15 @@ static int partition_indices_material_faces(MutableSpan<int> indices,
 /* Add a vertex to the map, with a positive value for unique vertices and
  * a negative value for additional vertices */
 static int map_insert_vert(Map<int, int> &map,
-                           MutableSpan<bool> vert_bitmap,
+                           const Span<int> vert_to_leaf,
+                           const int leaf,
                            int *face_verts,
                            int *uniq_verts,
                            int vertex)
 {
   return map.lookup_or_add_cb(vertex, [&]() {
     int value;
-    if (!vert_bitmap[vertex]) {
-      vert_bitmap[vertex] = true;
+    if (vert_to_leaf[vertex] == leaf) {
       value = *uniq_verts;
       (*uniq_verts)++;
     }
@@ -253,7 +253,8 @@ static void build_mesh_leaf_node(const Span<int> corner_verts,
                                  const Span<int3> corner_tris,
                                  const Span<int> tri_faces,
                                  const Span<bool> hide_poly,
-                                 MutableSpan<bool> vert_bitmap,
+                                 const Span<int> vert_to_leaf,
+                                 const int leaf,
                                  PBVHNode *node)
 {
   node->uniq_verts = node->face_verts = 0;
@@ -269,7 +270,7 @@ static void build_mesh_leaf_node(const Span<int> corner_verts,
     const int3 &tri = corner_tris[prim_indices[i]];
     for (int j = 0; j < 3; j++) {
       node->face_vert_indices[i][j] = map_insert_vert(
-          map, vert_bitmap, &node->face_verts, &node->uniq_verts, corner_verts[tri[j]]);
+          map, vert_to_leaf, leaf, &node->face_verts, &node->uniq_verts, corner_verts[tri[j]]);
     }
   }
 
@@ -359,11 +360,6 @@ static void build_grid_leaf_node(PBVH *pbvh, PBVHNode *node)
 }
 
 static void build_leaf(PBVH *pbvh,
-                       const Span<int> corner_verts,
-                       const Span<int3> corner_tris,
-                       const Span<int> tri_faces,
-                       const Span<bool> hide_poly,
-                       MutableSpan<bool> vert_bitmap,
                        int node_index,
                        const Span<Bounds<float3>> prim_bounds,
                        int offset,
@@ -377,14 +373,57 @@ static void build_leaf(PBVH *pbvh,
   /* Still need vb for searches */
   update_vb(pbvh->prim_indices, &node, prim_bounds, offset, count);
 
-  if (!pbvh->corner_tris.is_empty()) {
-    build_mesh_leaf_node(corner_verts, corner_tris, tri_faces, hide_poly, vert_bitmap, &node);
-  }
-  else {
+  /* Mesh leaf nodes are built afterwards, see #build_mesh_leaf_nodes. */
+  if (pbvh->corner_tris.is_empty()) {
     build_grid_leaf_node(pbvh, &node);
   }
 }
 
+/**
+ * Build the vertex indices of all mesh leaf nodes in parallel. A vertex is unique to the first
+ * leaf using it, in the order the leaves were created by #build_sub.
+ */
+static void build_mesh_leaf_nodes(PBVH *pbvh,
+                                  const Span<int> corner_verts,
+                                  const Span<int3> corner_tris,
+                                  const Span<int> tri_faces,
+                                  const Span<bool> hide_poly,
+                                  const int verts_num)
+{
+  /* Depth-first traversal with the first child first gives the order of #build_sub. */
+  Vector<PBVHNode *> leaves;
+  Vector<int> stack = {0};
+  while (!stack.is_empty()) {
+    PBVHNode &node = pbvh->nodes[stack.pop_last()];
+    if (node.flag & PBVH_Leaf) {
+      leaves.append(&node);
+    }
+    else {
+      stack.append(node.children_offset + 1);
+      stack.append(node.children_offset);
+    }
+  }
+
+  Array<int> vert_to_leaf(verts_num, -1);
+  for (const int leaf : leaves.index_range()) {
+    for (const int tri : leaves[leaf]->prim_indices) {
+      for (int j = 0; j < 3; j++) {
+        int &vert_leaf = vert_to_leaf[corner_verts[corner_tris[tri][j]]];
+        if (vert_leaf == -1) {
+          vert_leaf = leaf;
+        }
+      }
+    }
+  }
+
+  threading::parallel_for(leaves.index_range(), 1, [&](const IndexRange range) {
+    for (const int leaf : range) {
+      build_mesh_leaf_node(
+          corner_verts, corner_tris, tri_faces, hide_poly, vert_to_leaf, leaf, leaves[leaf]);
+    }
+  });
+}
+
 /* Return zero if all primitives in the node can be drawn with the
  * same material (including flat/smooth shading), non-zero otherwise */
 static bool leaf_needs_material_split(PBVH *pbvh,
@@ -455,13 +494,9 @@ static void test_face_boundaries(PBVH *pbvh, const Mesh &mesh)
  */
 
 static void build_sub(PBVH *pbvh,
-                      const Span<int> corner_verts,
-                      const Span<int3> corner_tris,
                       const Span<int> tri_faces,
-                      const Span<bool> hide_poly,
                       const Span<int> material_indices,
                       const Span<bool> sharp_faces,
-                      MutableSpan<bool> vert_bitmap,
                       int node_index,
                       const Bounds<float3> *cb,
                       const Span<Bounds<float3>> prim_bounds,
@@ -485,16 +520,7 @@ static void build_sub(PBVH *pbvh,
     if (!leaf_needs_material_split(
             pbvh, prim_to_face_map, material_indices, sharp_faces, offset, count))
     {
-      build_leaf(pbvh,
-                 corner_verts,
-                 corner_tris,
-                 tri_faces,
-                 hide_poly,
-                 vert_bitmap,
-                 node_index,
-                 prim_bounds,
-                 offset,
-                 count);
+      build_leaf(pbvh, node_index, prim_bounds, offset, count);
 
       if (node_index == 0) {
         MEM_SAFE_FREE(prim_scratch);
@@ -547,13 +573,9 @@ static void build_sub(PBVH *pbvh,
 
   /* Build children */
   build_sub(pbvh,
-            corner_verts,
-            corner_tris,
             tri_faces,
-            hide_poly,
             material_indices,
             sharp_faces,
-            vert_bitmap,
             pbvh->nodes[node_index].children_offset,
             nullptr,
             prim_bounds,
@@ -562,13 +584,9 @@ static void build_sub(PBVH *pbvh,
             prim_scratch,
             depth + 1);
   build_sub(pbvh,
-            corner_verts,
-            corner_tris,
             tri_faces,
-            hide_poly,
             material_indices,
             sharp_faces,
-            vert_bitmap,
             pbvh->nodes[node_index].children_offset + 1,
             nullptr,
             prim_bounds,
@@ -583,13 +601,9 @@ static void build_sub(PBVH *pbvh,
 }
 
 static void pbvh_build(PBVH *pbvh,
-                       const Span<int> corner_verts,
-                       const Span<int3> corner_tris,
                        const Span<int> tri_faces,
-                       const Span<bool> hide_poly,
                        const Span<int> material_indices,
                        const Span<bool> sharp_faces,
-                       MutableSpan<bool> vert_bitmap,
                        const Bounds<float3> *cb,
                        const Span<Bounds<float3>> prim_bounds,
                        int totprim)
@@ -604,21 +618,8 @@ static void pbvh_build(PBVH *pbvh,
 
   pbvh->nodes.resize(1);
 
-  build_sub(pbvh,
-            corner_verts,
-            corner_tris,
-            tri_faces,
-            hide_poly,
-            material_indices,
-            sharp_faces,
-            vert_bitmap,
-            0,
-            cb,
-            prim_bounds,
-            0,
-            totprim,
-            nullptr,
-            0);
+  build_sub(
+      pbvh, tri_faces, material_indices, sharp_faces, 0, cb, prim_bounds, 0, totprim, nullptr, 0);
 }
 
 #ifdef VALIDATE_UNIQUE_NODE_FACES
@@ -723,7 +724,6 @@ PBVH *build_mesh(Mesh *mesh)
   update_mesh_pointers(pbvh.get(), mesh);
   const Span<int> tri_faces = pbvh->corner_tri_faces;
 
-  Array<bool> vert_bitmap(totvert, false);
   pbvh->totvert = totvert;
 
 #ifdef TEST_PBVH_FACE_SPLIT
@@ -761,17 +761,9 @@ PBVH *build_mesh(Mesh *mesh)
     const VArraySpan hide_poly = *attributes.lookup<bool>(".hide_poly", AttrDomain::Face);
     const VArraySpan material_index = *attributes.lookup<int>("material_index", AttrDomain::Face);
     const VArraySpan sharp_face = *attributes.lookup<bool>("sharp_face", AttrDomain::Face);
-    pbvh_build(pbvh.get(),
-               corner_verts,
-               corner_tris,
-               tri_faces,
-               hide_poly,
-               material_index,
-               sharp_face,
-               vert_bitmap,
-               &cb,
-               prim_bounds,
-               corner_tris_num);
+    pbvh_build(
+        pbvh.get(), tri_faces, material_index, sharp_face, &cb, prim_bounds, corner_tris_num);
+    build_mesh_leaf_nodes(pbvh.get(), corner_verts, corner_tris, tri_faces, hide_poly, totvert);
 
 #ifdef TEST_PBVH_FACE_SPLIT
     test_face_boundaries(pbvh, tri_faces);
@@ -839,17 +831,7 @@ PBVH *build_grids(const CCGKey *key, Mesh *mesh, SubdivCCG *subdiv_ccg)
     const AttributeAccessor attributes = mesh->attributes();
     const VArraySpan material_index = *attributes.lookup<int>("material_index", AttrDomain::Face);
     const VArraySpan sharp_face = *attributes.lookup<bool>("sharp_face", AttrDomain::Face);
-    pbvh_build(pbvh.get(),
-               {},
-               {},
-               {},
-               {},
-               material_index,
-               sharp_face,
-               {},
-               &cb,
-               prim_bounds,
-               grids.size());
+    pbvh_build(pbvh.get(), {}, material_index, sharp_face, &cb, prim_bounds, grids.size());
   }
 
 #ifdef VALIDATE_UNIQUE_NODE_FACES
@@ -1634,32 +1634,81 @@ static int ptcache_file_write(PTCacheFile *pf, const void *f, uint tot, uint siz
 {
   return (fwrite(f, size, tot, pf->fp) == tot);
 }
-static int ptcache_file_data_read(PTCacheFile *pf)
+/* Uncompressed point data is stored interleaved per point. Read and write it in chunks of points
+ * instead of one value at a time, which avoids many small file operations for large caches. */
+#define PTCACHE_FILE_POINTS_CHUNK 1024
+
+static uint ptcache_file_point_size(const int data_types)
 {
-  int i;
+  uint size = 0;
+  for (int i = 0; i < BPHYS_TOT_DATA; i++) {
+    if (data_types & (1 << i)) {
+      size += ptcache_data_size[i];
+    }
+  }
+  return size;
+}
+static int ptcache_file_points_read(PTCacheFile *pf, PTCacheMem *pm)
+{
+  const uint point_size = ptcache_file_point_size(pf->data_types);
+  uchar *buffer = static_cast<uchar *>(
+      MEM_malloc_arrayN(PTCACHE_FILE_POINTS_CHUNK, point_size, __func__));
+  int ok = 1;
 
-  for (i = 0; i < BPHYS_TOT_DATA; i++) {
-    if ((pf->data_types & (1 << i)) && !ptcache_file_read(pf, pf->cur[i], 1, ptcache_data_size[i]))
-    {
-      return 0;
+  for (uint start = 0; start < pm->totpoint; start += PTCACHE_FILE_POINTS_CHUNK) {
+    const uint points_num = std::min<uint>(PTCACHE_FILE_POINTS_CHUNK, pm->totpoint - start);
+    if (!ptcache_file_read(pf, buffer, points_num, point_size)) {
+      ok = 0;
+      break;
+    }
+    const uchar *src = buffer;
+    for (uint point = start; point < start + points_num; point++) {
+      for (int i = 0; i < BPHYS_TOT_DATA; i++) {
+        if (pf->data_types & (1 << i)) {
+          if (pm->data[i]) {
+            memcpy(static_cast<uchar *>(pm->data[i]) + size_t(point) * ptcache_data_size[i],
+                   src,
+                   ptcache_data_size[i]);
+          }
+          src += ptcache_data_size[i];
+        }
+      }
     }
   }
 
-  return 1;
+  MEM_freeN(buffer);
+  return ok;
 }
-static int ptcache_file_data_write(PTCacheFile *pf)
+static int ptcache_file_points_write(PTCacheFile *pf, const PTCacheMem *pm)
 {
-  int i;
+  const uint point_size = ptcache_file_point_size(pf->data_types);
+  uchar *buffer = static_cast<uchar *>(
+      MEM_calloc_arrayN(PTCACHE_FILE_POINTS_CHUNK, point_size, __func__));
+  int ok = 1;
 
-  for (i = 0; i < BPHYS_TOT_DATA; i++) {
-    if ((pf->data_types & (1 << i)) &&
-        !ptcache_file_write(pf, pf->cur[i], 1, ptcache_data_size[i]))
-    {
-      return 0;
+  for (uint start = 0; start < pm->totpoint; start += PTCACHE_FILE_POINTS_CHUNK) {
+    const uint points_num = std::min<uint>(PTCACHE_FILE_POINTS_CHUNK, pm->totpoint - start);
+    uchar *dst = buffer;
+    for (uint point = start; point < start + points_num; point++) {
+      for (int i = 0; i < BPHYS_TOT_DATA; i++) {
+        if (pf->data_types & (1 << i)) {
+          if (pm->data[i]) {
+            memcpy(dst,
+                   static_cast<const uchar *>(pm->data[i]) + size_t(point) * ptcache_data_size[i],
+                   ptcache_data_size[i]);
+          }
+          dst += ptcache_data_size[i];
+        }
+      }
+    }
+    if (!ptcache_file_write(pf, buffer, points_num, point_size)) {
+      ok = 0;
+      break;
     }
   }
 
-  return 1;
+  MEM_freeN(buffer);
+  return ok;
 }
 static int ptcache_file_header_begin_read(PTCacheFile *pf)
 {
@@ -1831,18 +1880,6 @@ static void ptcache_data_free(PTCacheMem *pm)
     }
   }
 }
-static void ptcache_data_copy(void *from[], void *to[])
-{
-  int i;
-  for (i = 0; i < BPHYS_TOT_DATA; i++) {
-    /* NOTE: durian file 03.4b_comp crashes if to[i] is not tested
-     * its nullptr, not sure if this should be fixed elsewhere but for now its needed */
-    if (from[i] && to[i]) {
-      memcpy(to[i], from[i], ptcache_data_size[i]);
-    }
-  }
-}
-
 static void ptcache_extra_free(PTCacheMem *pm)
 {
   PTCacheExtra *extra = static_cast<PTCacheExtra *>(pm->extradata.first);
@@ -1972,19 +2009,8 @@ static PTCacheMem *ptcache_disk_frame_to_mem(PTCacheID *pid, int cfra)
         }
       }
     }
-    else {
-      void *cur[BPHYS_TOT_DATA];
-      BKE_ptcache_mem_pointers_init(pm, cur);
-      ptcache_file_pointers_init(pf);
-
-      for (i = 0; i < pm->totpoint; i++) {
-        if (!ptcache_file_data_read(pf)) {
-          error = 1;
-          break;
-        }
-        ptcache_data_copy(pf->cur, cur);
-        BKE_ptcache_mem_pointers_incr(cur);
-      }
+    else if (!ptcache_file_points_read(pf, pm)) {
+      error = 1;
     }
   }
 
@@ -2073,19 +2099,8 @@ static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm)
         }
       }
     }
-    else {
-      void *cur[BPHYS_TOT_DATA];
-      BKE_ptcache_mem_pointers_init(pm, cur);
-      ptcache_file_pointers_init(pf);
-
-      for (i = 0; i < pm->totpoint; i++) {
-        ptcache_data_copy(cur, pf->cur);
-        if (!ptcache_file_data_write(pf)) {
-          error = 1;
-          break;
-        }
-        BKE_ptcache_mem_pointers_incr(cur);
-      }
+    else if (!ptcache_file_points_write(pf, pm)) {
+      error = 1;
     }
   }
 
@@ -0,0 +1,69 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "DNA_pointcloud_types.h"
+
+#include "BKE_bvhutils.hh"
+#include "BKE_idtype.hh"
+#include "BKE_lib_id.hh"
+#include "BKE_pointcloud.hh"
+
+#include "BLI_index_mask.hh"
+#include "BLI_kdopbvh.h"
+#include "BLI_math_vector_types.hh"
+
+#include "RNA_access.hh"
+#include "RNA_prototypes.h"
+
+namespace blender::bke::tests {
+
+class PointCloudTest : public ::testing::Test {
+ public:
+  static void SetUpTestSuite()
+  {
+    BKE_idtype_init();
+  }
+};
+
+static int find_nearest_point(const PointCloud &pointcloud, const float3 &co)
+{
+  BVHTreeFromPointCloud bvh_data;
+  BKE_bvhtree_from_pointcloud_get(pointcloud, IndexMask(pointcloud.totpoint), bvh_data);
+  BVHTreeNearest nearest;
+  nearest.index = -1;
+  nearest.dist_sq = FLT_MAX;
+  BLI_bvhtree_find_nearest(bvh_data.tree, co, &nearest, nullptr, nullptr);
+  free_bvhtree_from_pointcloud(&bvh_data);
+  return nearest.index;
+}
+
+TEST_F(PointCloudTest, bvh_cache_rna_position_edit)
+{
+  PointCloud *pointcloud = BKE_pointcloud_new_nomain(2);
+  MutableSpan<float3> positions = pointcloud->positions_for_write();
+  positions[0] = float3(0.0f, 0.0f, 0.0f);
+  positions[1] = float3(10.0f, 0.0f, 0.0f);
+  pointcloud->tag_positions_changed();
+
+  /* Build the cached tree. */
+  EXPECT_EQ(find_nearest_point(*pointcloud, float3(9.0f, 0.0f, 0.0f)), 1);
+
+  /* Edit the second point through RNA, like a Python script does. */
+  PointerRNA ptr = RNA_pointer_create(&pointcloud->id, &RNA_Point, &positions[1]);
+  const float new_co[3] = {-10.0f, 0.0f, 0.0f};
+  RNA_float_set_array(&ptr, "co", new_co);
+
+  /* Copies share the cache, like the evaluated copy made by the depsgraph. */
+  PointCloud *pointcloud_copy = reinterpret_cast<PointCloud *>(
+      BKE_id_copy_ex(nullptr, &pointcloud->id, nullptr, LIB_ID_COPY_LOCALIZE));
+  EXPECT_EQ(find_nearest_point(*pointcloud_copy, float3(9.0f, 0.0f, 0.0f)), 0);
+  EXPECT_EQ(find_nearest_point(*pointcloud, float3(-9.0f, 0.0f, 0.0f)), 1);
+
+  BKE_id_free(nullptr, pointcloud_copy);
+  BKE_id_free(nullptr, pointcloud);
+}
+
+}  // namespace blender::bke::tests
@@ -11,7 +11,12 @@
 #include "DNA_mesh_types.h"
 #include "DNA_modifier_types.h"
 
+#include "BLI_implicit_sharing.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
+
+#include "BKE_customdata.hh"
+#include "BKE_mesh_types.hh"
 
 #include "BKE_subdiv_modifier.hh"
 
@@ -137,6 +142,123 @@ Subdiv *BKE_subdiv_new_from_mesh(const SubdivSettings *settings, const Mesh *mes
 
 /* Creation with cached-aware semantic. */
 
+/**
+ * Weak references to the implicitly shared arrays a topology refiner was created from, together
+ * with their versions. When a mesh still references the same unmodified arrays, its topology is
+ * known to match without building a converter and comparing the topology, which is the common
+ * case when only positions change, for example under an armature.
+ */
+struct SubdivTopologyFingerprint {
+  int verts_num;
+  int edges_num;
+  int faces_num;
+  int corners_num;
+  /** Null sharing info for data that does not exist on the mesh. */
+  blender::Vector<std::pair<const blender::ImplicitSharingInfo *, int64_t>> data;
+
+  ~SubdivTopologyFingerprint()
+  {
+    for (const auto &item : this->data) {
+      if (item.first) {
+        item.first->remove_weak_user_and_delete_if_last();
+      }
+    }
+  }
+};
+
+/**
+ * Gather the shared data that is used by the mesh converter.
+ * \return False when some of the data is not shared, so it can't be identified later on.
+ */
+static bool topology_fingerprint_gather(
+    const Mesh &mesh,
+    blender::Vector<std::pair<const blender::ImplicitSharingInfo *, int64_t>> &r_data)
+{
+  auto add_layer = [&](const CustomData &custom_data, const int layer_index) {
+    if (layer_index == -1) {
+      r_data.append({nullptr, 0});
+      return true;
+    }
+    const blender::ImplicitSharingInfo *sharing_info = custom_data.layers[layer_index].sharing_info;
+    if (sharing_info == nullptr) {
+      return false;
+    }
+    r_data.append({sharing_info, sharing_info->version()});
+    return true;
+  };
+  auto add_named_layer = [&](const CustomData &custom_data, const char *name) {
+    return add_layer(custom_data, CustomData_get_named_layer_index_notype(&custom_data, name));
+  };
+
+  if (mesh.faces_num > 0) {
+    const blender::ImplicitSharingInfo *sharing_info = mesh.runtime->face_offsets_sharing_info;
+    if (sharing_info == nullptr) {
+      return false;
+    }
+    r_data.append({sharing_info, sharing_info->version()});
+  }
+  if (!add_named_layer(mesh.edge_data, ".edge_verts") ||
+      !add_named_layer(mesh.corner_data, ".corner_vert") ||
+      !add_named_layer(mesh.corner_data, ".corner_edge") ||
+      !add_named_layer(mesh.vert_data, "crease_vert") ||
+      !add_named_layer(mesh.edge_data, "crease_edge"))
+  {
+    return false;
+  }
+  /* All UV maps are used to build face-varying channels. */
+  const int uv_layers_num = CustomData_number_of_layers(&mesh.corner_data, CD_PROP_FLOAT2);
+  for (const int i : blender::IndexRange(uv_layers_num)) {
+    if (!add_layer(mesh.corner_data,
+                   CustomData_get_layer_index_n(&mesh.corner_data, CD_PROP_FLOAT2, i)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool topology_fingerprint_matches(const SubdivTopologyFingerprint &fingerprint,
+                                         const Mesh &mesh)
+{
+  if (fingerprint.verts_num != mesh.verts_num || fingerprint.edges_num != mesh.edges_num ||
+      fingerprint.faces_num != mesh.faces_num || fingerprint.corners_num != mesh.corners_num)
+  {
+    return false;
+  }
+  blender::Vector<std::pair<const blender::ImplicitSharingInfo *, int64_t>> data;
+  if (!topology_fingerprint_gather(mesh, data)) {
+    return false;
+  }
+  return data.as_span() == fingerprint.data.as_span();
+}
+
+static void topology_fingerprint_free(Subdiv &subdiv)
+{
+  MEM_delete(subdiv.topology_fingerprint);
+  subdiv.topology_fingerprint = nullptr;
+}
+
+static void topology_fingerprint_update(Subdiv &subdiv, const Mesh &mesh)
+{
+  topology_fingerprint_free(subdiv);
+  blender::Vector<std::pair<const blender::ImplicitSharingInfo *, int64_t>> data;
+  if (!topology_fingerprint_gather(mesh, data)) {
+    return;
+  }
+  for (const auto &item : data) {
+    if (item.first) {
+      item.first->add_weak_user();
+    }
+  }
+  SubdivTopologyFingerprint *fingerprint = MEM_new<SubdivTopologyFingerprint>(__func__);
+  fingerprint->verts_num = mesh.verts_num;
+  fingerprint->edges_num = mesh.edges_num;
+  fingerprint->faces_num = mesh.faces_num;
+  fingerprint->corners_num = mesh.corners_num;
+  fingerprint->data = std::move(data);
+  subdiv.topology_fingerprint = fingerprint;
+}
+
 Subdiv *BKE_subdiv_update_from_converter(Subdiv *subdiv,
                                          const SubdivSettings *settings,
                                          OpenSubdiv_Converter *converter)
@@ -171,10 +293,20 @@ Subdiv *BKE_subdiv_update_from_mesh(Subdiv *subdiv,
                                     const SubdivSettings *settings,
                                     const Mesh *mesh)
 {
+  if (subdiv != nullptr && subdiv->topology_refiner != nullptr &&
+      subdiv->topology_fingerprint != nullptr &&
+      BKE_subdiv_settings_equal(&subdiv->settings, settings) &&
+      topology_fingerprint_matches(*subdiv->topology_fingerprint, *mesh))
+  {
+    return subdiv;
+  }
   OpenSubdiv_Converter converter;
   BKE_subdiv_converter_init_for_mesh(&converter, settings, mesh);
   subdiv = BKE_subdiv_update_from_converter(subdiv, settings, &converter);
   BKE_subdiv_converter_free(&converter);
+  if (subdiv != nullptr) {
+    topology_fingerprint_update(*subdiv, *mesh);
+  }
   return subdiv;
 }
 
@@ -182,6 +314,7 @@ Subdiv *BKE_subdiv_update_from_mesh(Subdiv *subdiv,
 
 void BKE_subdiv_free(Subdiv *subdiv)
 {
+  topology_fingerprint_free(*subdiv);
   if (subdiv->evaluator != nullptr) {
     const eOpenSubdivEvaluator evaluator_type = subdiv->evaluator->type;
     if (evaluator_type != OPENSUBDIV_EVALUATOR_CPU) {
@@ -888,13 +888,22 @@ static void subdiv_ccg_average_corners(SubdivCCG &subdiv_ccg,
   });
 }
 
+static void subdiv_ccg_average_inner_grids(SubdivCCG &subdiv_ccg,
+                                           const CCGKey &key,
+                                           const IndexMask &face_mask)
+{
+  face_mask.foreach_index(GrainSize(512), [&](const int face_index) {
+    subdiv_ccg_average_inner_face_grids(subdiv_ccg, key, subdiv_ccg.faces[face_index]);
+  });
+}
+
 void BKE_subdiv_ccg_average_grids(SubdivCCG &subdiv_ccg)
 {
   using namespace blender;
   const CCGKey key = BKE_subdiv_ccg_key_top_level(subdiv_ccg);
   /* Average inner boundaries of grids (within one face), across faces
    * from different face-corners. */
-  BKE_subdiv_ccg_average_stitch_faces(subdiv_ccg, subdiv_ccg.faces.index_range());
+  subdiv_ccg_average_inner_grids(subdiv_ccg, key, subdiv_ccg.faces.index_range());
   subdiv_ccg_average_boundaries(subdiv_ccg, key, subdiv_ccg.adjacent_edges.index_range());
   subdiv_ccg_average_corners(subdiv_ccg, key, subdiv_ccg.adjacent_verts.index_range());
 }
@@ -948,13 +957,15 @@ void BKE_subdiv_ccg_average_stitch_faces(SubdivCCG &subdiv_ccg, const IndexMask
 {
   using namespace blender;
   const CCGKey key = BKE_subdiv_ccg_key_top_level(subdiv_ccg);
-  face_mask.foreach_index(GrainSize(512), [&](const int face_index) {
-    subdiv_ccg_average_inner_face_grids(subdiv_ccg, key, subdiv_ccg.faces[face_index]);
-  });
-  /* TODO(sergey): Only average elements which are adjacent to modified
-   * faces. */
-  subdiv_ccg_average_boundaries(subdiv_ccg, key, subdiv_ccg.adjacent_edges.index_range());
-  subdiv_ccg_average_corners(subdiv_ccg, key, subdiv_ccg.adjacent_verts.index_range());
+  subdiv_ccg_average_inner_grids(subdiv_ccg, key, face_mask);
+  if (face_mask.size() == subdiv_ccg.faces.size()) {
+    subdiv_ccg_average_boundaries(subdiv_ccg, key, subdiv_ccg.adjacent_edges.index_range());
+    subdiv_ccg_average_corners(subdiv_ccg, key, subdiv_ccg.adjacent_verts.index_range());
+  }
+  else {
+    /* Only average elements which are adjacent to modified faces. */
+    subdiv_ccg_average_faces_boundaries_and_corners(subdiv_ccg, key, face_mask);
+  }
 }
 
 void BKE_subdiv_ccg_topology_counters(const SubdivCCG &subdiv_ccg,
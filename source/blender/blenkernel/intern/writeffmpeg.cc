@@ -694,8 +694,13 @@ static const AVCodec *get_av1_encoder(
   return codec;
 }
 
-static SwsContext *sws_create_context(
-    int width, int height, int av_src_format, int av_dst_format, int sws_flags)
+SwsContext *BKE_ffmpeg_sws_create_context(int src_width,
+                                          int src_height,
+                                          int av_src_format,
+                                          int dst_width,
+                                          int dst_height,
+                                          int av_dst_format,
+                                          int sws_flags)
 {
 #  if defined(FFMPEG_SWSCALE_THREADING)
   /* sws_getContext does not allow passing flags that ask for multi-threaded
@@ -704,11 +709,11 @@ static SwsContext *sws_create_context(
   if (c == nullptr) {
     return nullptr;
   }
-  av_opt_set_int(c, "srcw", width, 0);
-  av_opt_set_int(c, "srch", height, 0);
+  av_opt_set_int(c, "srcw", src_width, 0);
+  av_opt_set_int(c, "srch", src_height, 0);
   av_opt_set_int(c, "src_format", av_src_format, 0);
-  av_opt_set_int(c, "dstw", width, 0);
-  av_opt_set_int(c, "dsth", height, 0);
+  av_opt_set_int(c, "dstw", dst_width, 0);
+  av_opt_set_int(c, "dsth", dst_height, 0);
   av_opt_set_int(c, "dst_format", av_dst_format, 0);
   av_opt_set_int(c, "sws_flags", sws_flags, 0);
   av_opt_set_int(c, "threads", BLI_system_thread_count(), 0);
@@ -718,11 +723,11 @@ static SwsContext *sws_create_context(
     return nullptr;
   }
 #  else
-  SwsContext *c = sws_getContext(width,
-                                 height,
+  SwsContext *c = sws_getContext(src_width,
+                                 src_height,
                                  AVPixelFormat(av_src_format),
-                                 width,
-                                 height,
+                                 dst_width,
+                                 dst_height,
                                  AVPixelFormat(av_dst_format),
                                  sws_flags,
                                  nullptr,
@@ -801,7 +806,8 @@ SwsContext *BKE_ffmpeg_sws_get_context(
   }
   if (ctx == nullptr) {
     /* No free matching context in cache: create a new one. */
-    ctx = sws_create_context(width, height, av_src_format, av_dst_format, sws_flags);
+    ctx = BKE_ffmpeg_sws_create_context(
+        width, height, av_src_format, width, height, av_dst_format, sws_flags);
     SwscaleContext c;
     c.width = width;
     c.height = height;
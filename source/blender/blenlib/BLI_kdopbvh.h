@@ -137,6 +137,17 @@ void BLI_bvhtree_free(BVHTree *tree);
  * Construct: first insert points, then call balance.
  */
 void BLI_bvhtree_insert(BVHTree *tree, int index, const float co[3], int numpoints);
+/**
+ * Add \a leaf_num leaves at once, which are then filled in with #BLI_bvhtree_insert_at.
+ * Unlike #BLI_bvhtree_insert, this allows building the leaves from multiple threads.
+ * \return The position of the first added leaf.
+ */
+int BLI_bvhtree_insert_range(BVHTree *tree, int leaf_num);
+/**
+ * Set the bounds of a leaf added with #BLI_bvhtree_insert_range. Different leaves can be set
+ * from different threads.
+ */
+void BLI_bvhtree_insert_at(BVHTree *tree, int leaf, int index, const float co[3], int numpoints);
 void BLI_bvhtree_balance(BVHTree *tree);
 
 /**
@@ -152,6 +163,12 @@ bool BLI_bvhtree_update_node(
  * too much, operations on the tree may become suboptimal.
  */
 void BLI_bvhtree_update_tree(BVHTree *tree);
+/**
+ * Sum of the extents of all branch nodes relative to the extents of the root node. Moving leaves
+ * and refitting with #BLI_bvhtree_update_tree usually increases the cost, comparing it to the
+ * cost after balancing helps deciding when the tree should be rebuilt instead.
+ */
+float BLI_bvhtree_get_cost(const BVHTree *tree);
 
 /**
  * Use to check the total number of threads #BLI_bvhtree_overlap will use.
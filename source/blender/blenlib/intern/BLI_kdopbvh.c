@@ -1003,6 +1003,33 @@ void BLI_bvhtree_insert(BVHTree *tree, int index, const float co[3], int numpoin
   bvhtree_node_inflate(tree, node, tree->epsilon);
 }
 
+int BLI_bvhtree_insert_range(BVHTree *tree, const int leaf_num)
+{
+  /* insert should only possible as long as tree->branch_num is 0 */
+  BLI_assert(tree->branch_num <= 0);
+  BLI_assert((size_t)(tree->leaf_num + leaf_num) <=
+             MEM_allocN_len(tree->nodes) / sizeof(*(tree->nodes)));
+
+  const int first_leaf = tree->leaf_num;
+  tree->leaf_num += leaf_num;
+  return first_leaf;
+}
+
+void BLI_bvhtree_insert_at(
+    BVHTree *tree, const int leaf, const int index, const float co[3], const int numpoints)
+{
+  BLI_assert(tree->branch_num <= 0);
+  BLI_assert(leaf < tree->leaf_num);
+
+  BVHNode *node = tree->nodes[leaf] = &(tree->nodearray[leaf]);
+
+  create_kdop_hull(tree, node, co, numpoints, 0);
+  node->index = index;
+
+  /* inflate the bv with some epsilon */
+  bvhtree_node_inflate(tree, node, tree->epsilon);
+}
+
 bool BLI_bvhtree_update_node(
     BVHTree *tree, int index, const float co[3], const float co_moving[3], int numpoints)
 {
@@ -1040,6 +1067,32 @@ void BLI_bvhtree_update_tree(BVHTree *tree)
     node_join(tree, *index);
   }
 }
+
+static float node_extent_sum(const BVHTree *tree, const BVHNode *node)
+{
+  float sum = 0.0f;
+  for (axis_t axis_iter = tree->start_axis; axis_iter < tree->stop_axis; axis_iter++) {
+    sum += node->bv[(2 * axis_iter) + 1] - node->bv[(2 * axis_iter)];
+  }
+  return sum;
+}
+
+float BLI_bvhtree_get_cost(const BVHTree *tree)
+{
+  if (tree->branch_num == 0) {
+    return 0.0f;
+  }
+  const float root_extent = node_extent_sum(tree, tree->nodes[tree->leaf_num]);
+  if (root_extent <= 0.0f) {
+    return 0.0f;
+  }
+  float sum = 0.0f;
+  for (int i = 0; i < tree->branch_num; i++) {
+    sum += node_extent_sum(tree, tree->nodes[tree->leaf_num + i]);
+  }
+  return sum / root_extent;
+}
+
 int BLI_bvhtree_get_len(const BVHTree *tree)
 {
   return tree->leaf_num;
@@ -47,6 +47,7 @@
 #include "BLI_string.h"
 #include "BLI_string_utils.hh"
 #include "BLI_sys_types.h" /* For `intptr_t` support. */
+#include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
 /** Sizes above this must be allocated. */
@@ -177,6 +178,12 @@ size_t BLI_file_zstd_from_mem_at_pos(
 
   ZSTD_CCtx *ctx = ZSTD_createCCtx();
   ZSTD_CCtx_setParameter(ctx, ZSTD_c_compressionLevel, compression_level);
+  /* Large buffers (such as full resolution images) are split into jobs that are compressed by
+   * worker threads. The output stays a regular frame. This fails harmlessly when `Zstd` is built
+   * without multi-threading support, in which case compression happens on the calling thread. */
+  if (len >= 4 * 1024 * 1024) {
+    ZSTD_CCtx_setParameter(ctx, ZSTD_c_nbWorkers, BLI_system_thread_count());
+  }
 
   ZSTD_inBuffer input = {buf, len, 0};
 
@@ -11,9 +11,16 @@
 
 #include "BLI_filereader.h"
 #include "BLI_math_base.h"
+#include "BLI_task.h"
 
 #include "MEM_guardedalloc.h"
 
+/**
+ * When frames are read sequentially, decompress up to this many following frames in parallel,
+ * instead of decompressing one frame at a time. Frames are 1mb when written by Blender.
+ */
+#define ZSTD_READ_AHEAD_MAX_FRAMES 8
+
 typedef struct {
   FileReader reader;
 
@@ -28,8 +35,22 @@ typedef struct {
     size_t *compressed_ofs;
     size_t *uncompressed_ofs;
 
-    char *cached_content;
+    /**
+     * Decompressed content of the frames in the range
+     * `[cached_frame, cached_frame + cached_frames_num)`.
+     */
+    char *cached_content[ZSTD_READ_AHEAD_MAX_FRAMES];
     int cached_frame;
+    int cached_frames_num;
+    /** Number of frames to decompress at once when reading sequentially. */
+    int read_ahead_frames_num;
+
+    /**
+     * Decompressed content of a single frame read out of order (on-demand reading of data),
+     * kept separately so that it doesn't replace the read-ahead frames above.
+     */
+    char *random_content;
+    int random_frame;
   } seek;
 } ZstdReader;
 
@@ -126,6 +147,9 @@ static bool zstd_read_seek_table(ZstdReader *zstd)
   }
 
   zstd->seek.cached_frame = -1;
+  zstd->seek.random_frame = -1;
+  zstd->seek.read_ahead_frames_num = clamp_i(
+      BLI_task_scheduler_num_threads(), 1, ZSTD_READ_AHEAD_MAX_FRAMES);
 
   return true;
 }
@@ -153,42 +177,169 @@ static int zstd_frame_from_pos(ZstdReader *zstd, size_t pos)
   return low;
 }
 
-/* Ensure that the currently loaded frame is the correct one. */
-static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
+static void zstd_free_cache(ZstdReader *zstd)
 {
-  if (zstd->seek.cached_frame == frame) {
-    /* Cached frame matches, so just return it. */
-    return zstd->seek.cached_content;
+  for (int i = 0; i < zstd->seek.cached_frames_num; i++) {
+    /* When an error has occurred this may be NULL, see: #99744. */
+    MEM_SAFE_FREE(zstd->seek.cached_content[i]);
   }
+  zstd->seek.cached_frames_num = 0;
+  zstd->seek.cached_frame = -1;
+}
 
-  /* Cached frame doesn't match, so discard it and cache the wanted one instead. */
-  MEM_SAFE_FREE(zstd->seek.cached_content);
+static void zstd_free_random_cache(ZstdReader *zstd)
+{
+  MEM_SAFE_FREE(zstd->seek.random_content);
+  zstd->seek.random_frame = -1;
+}
+
+typedef struct ZstdDecompressTask {
+  const char *compressed_data;
+  size_t compressed_size;
+  char *uncompressed_data;
+  size_t uncompressed_size;
+} ZstdDecompressTask;
 
-  size_t compressed_size = zstd->seek.compressed_ofs[frame + 1] - zstd->seek.compressed_ofs[frame];
-  size_t uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
-                             zstd->seek.uncompressed_ofs[frame];
+static void zstd_decompress_task(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  ZstdDecompressTask *task = (ZstdDecompressTask *)taskdata;
+  size_t res = ZSTD_decompress(
+      task->uncompressed_data, task->uncompressed_size, task->compressed_data, task->compressed_size);
+  if (ZSTD_isError(res) || res < task->uncompressed_size) {
+    MEM_freeN(task->uncompressed_data);
+    task->uncompressed_data = NULL;
+  }
+}
+
+/**
+ * Read the compressed data of `frames_num` consecutive frames starting at `frame`, and
+ * decompress them into `r_content`. Multiple frames are decompressed in parallel.
+ *
+ * \return The number of frames that were decompressed, up to the first one that failed.
+ */
+static int zstd_decompress_frames(ZstdReader *zstd, int frame, int frames_num, char **r_content)
+{
+  /* Frames are stored consecutively, so they can be read with a single read. */
+  size_t compressed_start = zstd->seek.compressed_ofs[frame];
+  size_t compressed_size = zstd->seek.compressed_ofs[frame + frames_num] - compressed_start;
 
-  char *uncompressed_data = MEM_mallocN(uncompressed_size, __func__);
   char *compressed_data = MEM_mallocN(compressed_size, __func__);
-  if (zstd->base->seek(zstd->base, zstd->seek.compressed_ofs[frame], SEEK_SET) < 0 ||
+  if (zstd->base->seek(zstd->base, compressed_start, SEEK_SET) < 0 ||
       zstd->base->read(zstd->base, compressed_data, compressed_size) < compressed_size)
   {
     MEM_freeN(compressed_data);
-    MEM_freeN(uncompressed_data);
-    return NULL;
+    return 0;
+  }
+
+  ZstdDecompressTask tasks[ZSTD_READ_AHEAD_MAX_FRAMES];
+  for (int i = 0; i < frames_num; i++) {
+    const int task_frame = frame + i;
+    ZstdDecompressTask *task = &tasks[i];
+    task->compressed_data = compressed_data + (zstd->seek.compressed_ofs[task_frame] -
+                                               compressed_start);
+    task->compressed_size = zstd->seek.compressed_ofs[task_frame + 1] -
+                            zstd->seek.compressed_ofs[task_frame];
+    task->uncompressed_size = zstd->seek.uncompressed_ofs[task_frame + 1] -
+                              zstd->seek.uncompressed_ofs[task_frame];
+    task->uncompressed_data = MEM_mallocN(task->uncompressed_size, __func__);
   }
 
-  size_t res = ZSTD_decompressDCtx(
-      zstd->ctx, uncompressed_data, uncompressed_size, compressed_data, compressed_size);
+  if (frames_num == 1) {
+    size_t res = ZSTD_decompressDCtx(zstd->ctx,
+                                     tasks[0].uncompressed_data,
+                                     tasks[0].uncompressed_size,
+                                     tasks[0].compressed_data,
+                                     tasks[0].compressed_size);
+    if (ZSTD_isError(res) || res < tasks[0].uncompressed_size) {
+      MEM_freeN(tasks[0].uncompressed_data);
+      tasks[0].uncompressed_data = NULL;
+    }
+  }
+  else {
+    TaskPool *pool = BLI_task_pool_create(NULL, TASK_PRIORITY_HIGH);
+    for (int i = 0; i < frames_num; i++) {
+      BLI_task_pool_push(pool, zstd_decompress_task, &tasks[i], false, NULL);
+    }
+    BLI_task_pool_work_and_wait(pool);
+    BLI_task_pool_free(pool);
+  }
   MEM_freeN(compressed_data);
-  if (ZSTD_isError(res) || res < uncompressed_size) {
-    MEM_freeN(uncompressed_data);
-    return NULL;
+
+  /* Only keep the frames up to the first one that failed to decompress. */
+  int valid_frames_num = 0;
+  while (valid_frames_num < frames_num && tasks[valid_frames_num].uncompressed_data) {
+    valid_frames_num++;
+  }
+  for (int i = valid_frames_num; i < frames_num; i++) {
+    MEM_SAFE_FREE(tasks[i].uncompressed_data);
+  }
+  for (int i = 0; i < valid_frames_num; i++) {
+    r_content[i] = tasks[i].uncompressed_data;
   }
+  return valid_frames_num;
+}
+
+/* Replace the read-ahead frames with `frames_num` frames starting at `frame`. */
+static bool zstd_fill_cache(ZstdReader *zstd, int frame, int frames_num)
+{
+  zstd_free_cache(zstd);
 
+  const int valid_frames_num = zstd_decompress_frames(
+      zstd, frame, frames_num, zstd->seek.cached_content);
+  if (valid_frames_num == 0) {
+    return false;
+  }
   zstd->seek.cached_frame = frame;
-  zstd->seek.cached_content = uncompressed_data;
-  return uncompressed_data;
+  zstd->seek.cached_frames_num = valid_frames_num;
+  return true;
+}
+
+/* Replace the frame used for out of order reads. */
+static bool zstd_fill_random_cache(ZstdReader *zstd, int frame)
+{
+  zstd_free_random_cache(zstd);
+
+  if (zstd_decompress_frames(zstd, frame, 1, &zstd->seek.random_content) == 0) {
+    return false;
+  }
+  zstd->seek.random_frame = frame;
+  return true;
+}
+
+/* Ensure that the given frame is loaded in the cache. */
+static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
+{
+  const int cache_index = frame - zstd->seek.cached_frame;
+  if (zstd->seek.cached_frame != -1 && cache_index >= 0 &&
+      cache_index < zstd->seek.cached_frames_num)
+  {
+    /* Cached frame matches, so just return it. */
+    return zstd->seek.cached_content[cache_index];
+  }
+  if (frame == zstd->seek.random_frame) {
+    return zstd->seek.random_content;
+  }
+
+  /* Only read ahead when reading sequentially (the common case when scanning #BHead's),
+   * this includes continuing right after a frame that was read out of order.
+   * Random access (on-demand reading of data) only needs a single frame, which is kept
+   * separately so the read-ahead frames of an interleaved sequential scan are not discarded. */
+  if (zstd->seek.cached_frame == -1 ||
+      frame == zstd->seek.cached_frame + zstd->seek.cached_frames_num ||
+      (zstd->seek.random_frame != -1 && frame == zstd->seek.random_frame + 1))
+  {
+    const int frames_num = min_ii(zstd->seek.read_ahead_frames_num,
+                                  zstd->seek.frames_num - frame);
+    if (!zstd_fill_cache(zstd, frame, frames_num)) {
+      return NULL;
+    }
+    return zstd->seek.cached_content[0];
+  }
+
+  if (!zstd_fill_random_cache(zstd, frame)) {
+    return NULL;
+  }
+  return zstd->seek.random_content;
 }
 
 static int64_t zstd_read_seekable(FileReader *reader, void *buffer, size_t size)
@@ -281,10 +432,8 @@ static void zstd_close(FileReader *reader)
   if (zstd->reader.seek) {
     MEM_freeN(zstd->seek.uncompressed_ofs);
     MEM_freeN(zstd->seek.compressed_ofs);
-    /* When an error has occurred this may be NULL, see: #99744. */
-    if (zstd->seek.cached_content) {
-      MEM_freeN(zstd->seek.cached_content);
-    }
+    zstd_free_cache(zstd);
+    zstd_free_random_cache(zstd);
   }
   else {
     MEM_freeN((void *)zstd->in_buf.src);
@@ -2,6 +2,7 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <cstring>
 #include <fmt/format.h>
 #include <iostream>
 #include <mutex>
@@ -466,8 +467,34 @@ IndexMask IndexMask::from_bools(const IndexMask &universe,
                                 Span<bool> bools,
                                 IndexMaskMemory &memory)
 {
-  return IndexMask::from_predicate(
-      universe, GrainSize(1024), memory, [bools](const int64_t index) { return bools[index]; });
+  return detail::from_predicate_impl(
+      universe,
+      GrainSize(1024),
+      memory,
+      [bools](const IndexMaskSegment indices, int16_t *__restrict r_true_indices) -> int64_t {
+        const Span<int16_t> local_indices = indices.base_span();
+        if (unique_sorted_indices::non_empty_is_range(local_indices)) {
+          /* Fast paths for segments where none or all of the values are true, which are common
+           * for real-world selections. */
+          const bool *segment_bools = bools.data() + indices[0];
+          const size_t size = size_t(local_indices.size());
+          if (std::memchr(segment_bools, true, size) == nullptr) {
+            return 0;
+          }
+          if (std::memchr(segment_bools, false, size) == nullptr) {
+            std::copy(local_indices.begin(), local_indices.end(), r_true_indices);
+            return local_indices.size();
+          }
+        }
+        int16_t *r_current = r_true_indices;
+        const int64_t offset = indices.offset();
+        for (const int16_t local_index : local_indices) {
+          *r_current = local_index;
+          /* Branchless conditional increment. */
+          r_current += bools[offset + local_index];
+        }
+        return r_current - r_true_indices;
+      });
 }
 
 IndexMask IndexMask::from_bools(const IndexMask &universe,
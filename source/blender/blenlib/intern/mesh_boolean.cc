@@ -2660,17 +2660,20 @@ static void test_tri_inside_shapes(const IMesh &tm,
 static BVHTree *raycast_tree(const IMesh &tm)
 {
   BVHTree *tree = BLI_bvhtree_new(tm.face_size(), FLT_EPSILON, 4, 6);
-  for (int i : tm.face_index_range()) {
-    const Face *f = tm.face(i);
-    float t_cos[9];
-    for (int j = 0; j < 3; ++j) {
-      const Vert *v = f->vert[j];
-      for (int k = 0; k < 3; ++k) {
-        t_cos[3 * j + k] = float(v->co[k]);
+  const int leaf_start = BLI_bvhtree_insert_range(tree, tm.face_size());
+  threading::parallel_for(tm.face_index_range(), 2048, [&](IndexRange range) {
+    for (int i : range) {
+      const Face *f = tm.face(i);
+      float t_cos[9];
+      for (int j = 0; j < 3; ++j) {
+        const Vert *v = f->vert[j];
+        for (int k = 0; k < 3; ++k) {
+          t_cos[3 * j + k] = float(v->co[k]);
+        }
       }
+      BLI_bvhtree_insert_at(tree, leaf_start + i, i, t_cos, 3);
     }
-    BLI_bvhtree_insert(tree, i, t_cos, 3);
-  }
+  });
   BLI_bvhtree_balance(tree);
   return tree;
 }
@@ -2811,49 +2814,59 @@ static IMesh raycast_patches_boolean(const IMesh &tm,
   BVHTree *tree = raycast_tree(tm);
   Vector<Face *> out_faces;
   out_faces.reserve(tm.face_size());
-  Array<float> in_shape(nshapes, 0);
-  Array<int> winding(nshapes, 0);
-  for (int p : pinfo.index_range()) {
-    const Patch &patch = pinfo.patch(p);
-    /* For test triangle, choose one in the middle of patch list
-     * as the ones near the beginning may be very near other patches. */
-    int test_t_index = patch.tri(patch.tot_tri() / 2);
-    Face &tri_test = *tm.face(test_t_index);
-    /* Assume all triangles in a patch are in the same shape. */
-    int shape = shape_fn(tri_test.orig);
-    if (dbg_level > 0) {
-      std::cout << "process patch " << p << " = " << patch << "\n";
-      std::cout << "test tri = " << test_t_index << " = " << &tri_test << "\n";
-      std::cout << "shape = " << shape << "\n";
-    }
-    if (shape == -1) {
-      continue;
-    }
-    test_tri_inside_shapes(tm, shape_fn, nshapes, test_t_index, tree, in_shape);
-    for (int other_shape = 0; other_shape < nshapes; ++other_shape) {
-      if (other_shape == shape) {
-        continue;
-      }
-      bool need_high_confidence = (op == BoolOpType::Difference && shape != 0) ||
-                                  op == BoolOpType::Intersect;
-      bool inside = in_shape[other_shape] >= (need_high_confidence ? 0.5f : 0.1f);
+  /* The ray casts are independent for every patch, only gather the result in patch order. */
+  Array<bool> patch_keep(pinfo.tot_patch(), false);
+  Array<bool> patch_flip(pinfo.tot_patch(), false);
+  threading::parallel_for(pinfo.index_range(), 8, [&](IndexRange range) {
+    Array<float> in_shape(nshapes, 0);
+    Array<int> winding(nshapes, 0);
+    for (int p : range) {
+      const Patch &patch = pinfo.patch(p);
+      /* For test triangle, choose one in the middle of patch list
+       * as the ones near the beginning may be very near other patches. */
+      int test_t_index = patch.tri(patch.tot_tri() / 2);
+      Face &tri_test = *tm.face(test_t_index);
+      /* Assume all triangles in a patch are in the same shape. */
+      int shape = shape_fn(tri_test.orig);
       if (dbg_level > 0) {
-        std::cout << "test point is " << (inside ? "inside" : "outside") << " other_shape "
-                  << other_shape << " val = " << in_shape[other_shape] << "\n";
+        std::cout << "process patch " << p << " = " << patch << "\n";
+        std::cout << "test tri = " << test_t_index << " = " << &tri_test << "\n";
+        std::cout << "shape = " << shape << "\n";
       }
-      winding[other_shape] = inside;
-    }
-    bool do_flip;
-    bool do_remove = raycast_test_remove(op, winding, shape, &do_flip);
-    if (!do_remove) {
-      for (int t : patch.tris()) {
-        Face *f = tm.face(t);
-        if (!do_flip) {
-          out_faces.append(f);
+      if (shape == -1) {
+        continue;
+      }
+      test_tri_inside_shapes(tm, shape_fn, nshapes, test_t_index, tree, in_shape);
+      for (int other_shape = 0; other_shape < nshapes; ++other_shape) {
+        if (other_shape == shape) {
+          continue;
         }
-        else {
-          raycast_add_flipped(out_faces, *f, arena);
+        bool need_high_confidence = (op == BoolOpType::Difference && shape != 0) ||
+                                    op == BoolOpType::Intersect;
+        bool inside = in_shape[other_shape] >= (need_high_confidence ? 0.5f : 0.1f);
+        if (dbg_level > 0) {
+          std::cout << "test point is " << (inside ? "inside" : "outside") << " other_shape "
+                    << other_shape << " val = " << in_shape[other_shape] << "\n";
         }
+        winding[other_shape] = inside;
+      }
+      bool do_flip;
+      bool do_remove = raycast_test_remove(op, winding, shape, &do_flip);
+      patch_keep[p] = !do_remove;
+      patch_flip[p] = do_flip;
+    }
+  });
+  for (int p : pinfo.index_range()) {
+    if (!patch_keep[p]) {
+      continue;
+    }
+    for (int t : pinfo.patch(p).tris()) {
+      Face *f = tm.face(t);
+      if (!patch_flip[p]) {
+        out_faces.append(f);
+      }
+      else {
+        raycast_add_flipped(out_faces, *f, arena);
       }
     }
   }
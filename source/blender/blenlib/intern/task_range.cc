@@ -27,6 +27,7 @@
 #  include <tbb/enumerable_thread_specific.h>
 #  include <tbb/parallel_for.h>
 #  include <tbb/parallel_reduce.h>
+#  include <tbb/task_arena.h>
 #endif
 
 #ifdef WITH_TBB
@@ -166,8 +167,9 @@ void parallel_for_impl(const IndexRange range,
                        const FunctionRef<void(IndexRange)> function)
 {
 #ifdef WITH_TBB
-  /* Invoking tbb for small workloads has a large overhead. */
-  if (range.size() >= grain_size) {
+  /* Invoking tbb for small workloads has a large overhead. It is also pure overhead when there is
+   * only one thread to run the tasks on (e.g. when using `--threads 1`). */
+  if (range.size() >= grain_size && tbb::this_task_arena::max_concurrency() > 1) {
     lazy_threading::send_hint();
     tbb::parallel_for(
         tbb::blocked_range<int64_t>(range.first(), range.one_after_last(), grain_size),
@@ -188,6 +190,13 @@ void parallel_for_weighted_impl(
     const FunctionRef<void(IndexRange)> function,
     const FunctionRef<void(IndexRange, MutableSpan<int64_t>)> task_sizes_fn)
 {
+#ifdef WITH_TBB
+  if (tbb::this_task_arena::max_concurrency() == 1) {
+    /* Balancing the work is not necessary, avoid computing the task sizes. */
+    function(range);
+    return;
+  }
+#endif
   /* Shouldn't be too small, because then there is more overhead when the individual tasks are
    * small. Also shouldn't be too large because then the serial code to split up tasks causes extra
    * overhead. */
@@ -191,6 +191,41 @@ TEST(index_mask, FromPredicate)
   }
 }
 
+TEST(index_mask, FromBools)
+{
+  IndexMaskMemory memory;
+  Array<bool> bools(100'000, false);
+  {
+    const IndexMask mask = IndexMask::from_bools(bools, memory);
+    EXPECT_TRUE(mask.is_empty());
+  }
+  bools.as_mutable_span().slice(20'000, 50'000).fill(true);
+  {
+    const IndexMask mask = IndexMask::from_bools(bools, memory);
+    EXPECT_EQ(mask.to_range(), IndexRange(20'000, 50'000));
+  }
+  bools[3] = true;
+  bools[90'000] = true;
+  bools[30'000] = false;
+  {
+    const IndexMask mask = IndexMask::from_bools(bools, memory);
+    EXPECT_EQ(mask.size(), 50'001);
+    EXPECT_TRUE(mask.contains(3));
+    EXPECT_TRUE(mask.contains(90'000));
+    EXPECT_FALSE(mask.contains(30'000));
+  }
+  {
+    /* Universe with segments that are not ranges. */
+    const IndexMask universe = IndexMask::from_predicate(
+        IndexRange(100'000), GrainSize(1024), memory, [](const int64_t i) { return i % 2 == 0; });
+    const IndexMask mask = IndexMask::from_bools(universe, bools, memory);
+    EXPECT_EQ(mask.size(), 25'000);
+    EXPECT_FALSE(mask.contains(3));
+    EXPECT_TRUE(mask.contains(90'000));
+    EXPECT_FALSE(mask.contains(30'000));
+  }
+}
+
 TEST(index_mask, IndexIteratorConversionFuzzy)
 {
   RandomNumberGenerator rng;
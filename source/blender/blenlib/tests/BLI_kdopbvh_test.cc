@@ -134,3 +134,75 @@ TEST(kdopbvh, OptimalFindNearest_500)
 {
   find_nearest_points_test(500, 1.0, 1000, 12, true);
 }
+
+TEST(kdopbvh, InsertRange)
+{
+  const int points_len = 500;
+  RNG *rng = BLI_rng_new(42);
+  BVHTree *tree = BLI_bvhtree_new(points_len, 0.0, 8, 8);
+
+  void *mem = MEM_mallocN(sizeof(float[3]) * points_len, __func__);
+  float(*points)[3] = (float(*)[3])mem;
+
+  EXPECT_EQ(BLI_bvhtree_insert_range(tree, points_len), 0);
+  /* Fill in the leaves in reverse order, they don't depend on each other. */
+  for (int i = points_len - 1; i >= 0; i--) {
+    rng_v3_round(points[i], 3, rng, 1000, 1.0f);
+    BLI_bvhtree_insert_at(tree, i, i, points[i], 1);
+  }
+  EXPECT_EQ(BLI_bvhtree_get_len(tree), points_len);
+  BLI_bvhtree_balance(tree);
+
+  for (int i = 0; i < points_len; i++) {
+    const int j = BLI_bvhtree_find_nearest(tree, points[i], nullptr, nullptr, nullptr);
+    EXPECT_EQ_ARRAY(points[i], points[j], 3);
+  }
+
+  BLI_bvhtree_free(tree);
+  BLI_rng_free(rng);
+  MEM_freeN(points);
+}
+
+TEST(kdopbvh, RefitCost)
+{
+  const int points_len = 500;
+  RNG *rng = BLI_rng_new(7);
+  BVHTree *tree = BLI_bvhtree_new(points_len, 0.0, 8, 8);
+
+  void *mem = MEM_mallocN(sizeof(float[3]) * points_len, __func__);
+  float(*points)[3] = (float(*)[3])mem;
+
+  for (int i = 0; i < points_len; i++) {
+    rng_v3_round(points[i], 3, rng, 1000, 1.0f);
+    BLI_bvhtree_insert(tree, i, points[i], 1);
+  }
+  BLI_bvhtree_balance(tree);
+  const float build_cost = BLI_bvhtree_get_cost(tree);
+  EXPECT_GT(build_cost, 0.0f);
+
+  /* Scaling all points uniformly does not change the relative cost. */
+  for (int i = 0; i < points_len; i++) {
+    mul_v3_fl(points[i], 2.0f);
+    BLI_bvhtree_update_node(tree, i, points[i], nullptr, 1);
+  }
+  BLI_bvhtree_update_tree(tree);
+  EXPECT_NEAR(BLI_bvhtree_get_cost(tree), build_cost, build_cost * 1e-3f);
+
+  /* Moving the points randomly makes every branch about as large as the root. */
+  for (int i = 0; i < points_len; i++) {
+    rng_v3_round(points[i], 3, rng, 1000, 1.0f);
+    BLI_bvhtree_update_node(tree, i, points[i], nullptr, 1);
+  }
+  BLI_bvhtree_update_tree(tree);
+  EXPECT_GT(BLI_bvhtree_get_cost(tree), build_cost * 1.5f);
+
+  /* Refit trees still find the right points. */
+  for (int i = 0; i < points_len; i++) {
+    const int j = BLI_bvhtree_find_nearest(tree, points[i], nullptr, nullptr, nullptr);
+    EXPECT_EQ_ARRAY(points[i], points[j], 3);
+  }
+
+  BLI_bvhtree_free(tree);
+  BLI_rng_free(rng);
+  MEM_freeN(points);
+}
@@ -0,0 +1,100 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "BLI_array.hh"
+#include "BLI_index_mask.hh"
+#include "BLI_rand.hh"
+#include "BLI_timeit.hh"
+
+using namespace blender;
+
+/* Number of bools/indices used by the tests. */
+static constexpr int64_t TESTCASE_SIZE = 100'000'000;
+
+/**
+ * Fill with runs of random lengths, so that both the mostly-true/false segments and mixed
+ * segments are exercised. With a run length of 1 the values are fully random.
+ */
+static Array<bool> random_bools(const int64_t size, const int max_run_length, const float density)
+{
+  RandomNumberGenerator rng(0);
+  Array<bool> bools(size);
+  int64_t i = 0;
+  while (i < size) {
+    const int64_t run_length = std::min<int64_t>(rng.get_int32(max_run_length) + 1, size - i);
+    const bool value = rng.get_float() < density;
+    bools.as_mutable_span().slice(i, run_length).fill(value);
+    i += run_length;
+  }
+  return bools;
+}
+
+static void from_bools_tests(const Span<bool> bools, const char *id)
+{
+  printf("\n========== STARTING %s ==========\n", id);
+
+  int64_t size = 0;
+  {
+    SCOPED_TIMER("from_bools");
+    IndexMaskMemory memory;
+    const IndexMask mask = IndexMask::from_bools(bools, memory);
+    size = mask.size();
+  }
+  {
+    SCOPED_TIMER("from_predicate");
+    IndexMaskMemory memory;
+    const IndexMask mask = IndexMask::from_predicate(
+        bools.index_range(), GrainSize(4096), memory, [&](const int64_t i) { return bools[i]; });
+    EXPECT_EQ(mask.size(), size);
+  }
+
+  IndexMaskMemory memory;
+  const IndexMask mask = IndexMask::from_bools(bools, memory);
+  {
+    SCOPED_TIMER("foreach_index");
+    int64_t sum = 0;
+    mask.foreach_index([&](const int64_t i) { sum += i; });
+    EXPECT_GE(sum, 0);
+  }
+  {
+    SCOPED_TIMER("foreach_index_optimized");
+    int64_t sum = 0;
+    mask.foreach_index_optimized<int64_t>([&](const int64_t i) { sum += i; });
+    EXPECT_GE(sum, 0);
+  }
+  {
+    SCOPED_TIMER("to_bools");
+    Array<bool> result(bools.size());
+    mask.to_bools(result);
+    EXPECT_EQ(result.as_span(), bools);
+  }
+
+  printf("========== ENDED %s ==========\n\n", id);
+}
+
+TEST(index_mask, FromBoolsRandom)
+{
+  const Array<bool> bools = random_bools(TESTCASE_SIZE, 1, 0.5f);
+  from_bools_tests(bools, "IndexMask - Random");
+}
+
+TEST(index_mask, FromBoolsShortRuns)
+{
+  const Array<bool> bools = random_bools(TESTCASE_SIZE, 64, 0.5f);
+  from_bools_tests(bools, "IndexMask - Short Runs");
+}
+
+TEST(index_mask, FromBoolsLongRuns)
+{
+  const Array<bool> bools = random_bools(TESTCASE_SIZE, 100'000, 0.5f);
+  from_bools_tests(bools, "IndexMask - Long Runs");
+}
+
+TEST(index_mask, FromBoolsSparse)
+{
+  const Array<bool> bools = random_bools(TESTCASE_SIZE, 1, 0.01f);
+  from_bools_tests(bools, "IndexMask - Sparse");
+}
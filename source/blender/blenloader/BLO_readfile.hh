@@ -101,6 +101,12 @@ struct BlendFileReadReport {
   /** Timing information. */
   struct {
     double whole;
+    /** Reading and direct-linking the data-blocks of the main file. */
+    double read_data_blocks;
+    /** Versioning of the main file and its libraries, both before and after linking. */
+    double versioning;
+    /** Linking and after-linking processing of all data, also included in #libraries. */
+    double lib_link;
     double libraries;
     double lib_overrides;
     double lib_overrides_resync;
@@ -36,6 +36,12 @@ struct MemFileChunk {
   size_t size;
   /** When true, this chunk doesn't own the memory, it's shared with a previous #MemFileChunk */
   bool is_identical;
+  /**
+   * When true, this chunk doesn't own the memory either, it's shared with a chunk of the same ID
+   * in the previous step that was at a different position. Unlike #is_identical this does not
+   * mean that the data did not change, since the chunks of the ID were re-ordered.
+   */
+  bool is_shared_moved;
   /** When true, this chunk is also identical to the one in the next step (used by undo code to
    * detect unchanged IDs).
    * Defined when writing the next step (i.e. last undo step has those always false). */
@@ -64,6 +70,15 @@ struct MemFileWriteData {
 
   /** Maps an ID session uid to its first reference MemFileChunk, if existing. */
   blender::Map<uint, MemFileChunk *> id_session_uid_mapping;
+
+  /**
+   * Maps content hashes to the reference chunks of the ID currently being written. Built on the
+   * first chunk of that ID which does not match its reference in order, to still share data when
+   * chunks were inserted or removed in the middle of the ID.
+   */
+  blender::Map<uint32_t, MemFileChunk *> id_reference_chunks_by_hash;
+  /** Session UID of the ID #id_reference_chunks_by_hash was built for. */
+  uint id_reference_chunks_session_uid;
 };
 
 struct MemFileUndoData {
@@ -6,6 +6,7 @@
  * \ingroup blenloader
  */
 
+#include <atomic>
 #include <cctype> /* for isdigit. */
 #include <cerrno>
 #include <climits>
@@ -47,6 +48,7 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
 #include "BLI_blenlib.h"
 #include "BLI_endian_defines.h"
 #include "BLI_endian_switch.h"
@@ -55,8 +57,10 @@
 #include "BLI_map.hh"
 #include "BLI_memarena.h"
 #include "BLI_mempool.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_time.h"
+#include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
 
@@ -202,6 +206,15 @@ struct BHeadN {
  */
 #define BHEAD_USE_READ_ON_DEMAND(bhead) ((bhead)->code == BLO_CODE_DATA)
 
+/**
+ * For ID blocks only the start of the data is read up-front, which is enough for the name and
+ * asset lookups. The remainder is read on demand when the ID itself is read, so IDs of libraries
+ * that are never linked or appended don't have to be kept in memory.
+ */
+#define BHEAD_ID_PREFIX_SIZE int64_t(sizeof(ID))
+#define BHEAD_USE_READ_ID_PREFIX(bhead) \
+  (blo_bhead_is_id(bhead) && (bhead)->len > BHEAD_ID_PREFIX_SIZE)
+
 /* -------------------------------------------------------------------- */
 /** \name Blend Loader Reporting Wrapper
  * \{ */
@@ -262,6 +275,21 @@ static void oldnewmap_insert(OldNewMap *onm, const void *oldaddr, void *newaddr,
   onm->map.add_overwrite(oldaddr, NewAddress{newaddr, nr});
 }
 
+/**
+ * Insert many addresses at once, growing the map only once.
+ * Null addresses are skipped, the same as with #oldnewmap_insert.
+ */
+static void oldnewmap_insert_array(OldNewMap *onm,
+                                   const blender::Span<const void *> oldaddrs,
+                                   const blender::Span<void *> newaddrs)
+{
+  BLI_assert(oldaddrs.size() == newaddrs.size());
+  onm->map.reserve(onm->map.size() + oldaddrs.size());
+  for (const int64_t i : oldaddrs.index_range()) {
+    oldnewmap_insert(onm, oldaddrs[i], newaddrs[i], 0);
+  }
+}
+
 static void oldnewmap_lib_insert(FileData *fd, const void *oldaddr, ID *newaddr, int id_code)
 {
   oldnewmap_insert(fd->libmap, oldaddr, newaddr, id_code);
@@ -301,6 +329,13 @@ static void *oldnewmap_liblookup(OldNewMap *onm, const void *addr, const bool is
   return nullptr;
 }
 
+/**
+ * Maps with at most this many slots keep their memory when cleared. The data-map is cleared
+ * after reading every ID, re-growing it from scratch each time is wasteful, but clearing a
+ * large map also has to touch every slot, so maps grown by big IDs are still freed.
+ */
+#define OLDNEWMAP_CLEAR_KEEP_CAPACITY_MAX 1024
+
 static void oldnewmap_clear(OldNewMap *onm)
 {
   /* Free unused data. */
@@ -309,7 +344,12 @@ static void oldnewmap_clear(OldNewMap *onm)
       MEM_freeN(new_addr.newp);
     }
   }
-  onm->map.clear_and_shrink();
+  if (onm->map.capacity() <= OLDNEWMAP_CLEAR_KEEP_CAPACITY_MAX) {
+    onm->map.clear();
+  }
+  else {
+    onm->map.clear_and_shrink();
+  }
 }
 
 static void oldnewmap_free(OldNewMap *onm)
@@ -767,6 +807,31 @@ static BHeadN *get_bhead(FileData *fd)
           fd->is_eof = true;
         }
       }
+      else if (fd->file->seek != nullptr && BHEAD_USE_READ_ID_PREFIX(&bhead)) {
+        /* Only read the start of the ID, the remainder is read on demand. */
+        const size_t prefix_size = size_t(BHEAD_ID_PREFIX_SIZE);
+        new_bhead = static_cast<BHeadN *>(
+            MEM_mallocN(sizeof(BHeadN) + prefix_size, "new_bhead"));
+        if (new_bhead) {
+          new_bhead->next = new_bhead->prev = nullptr;
+          new_bhead->file_offset = fd->file->offset;
+          new_bhead->has_data = false;
+          new_bhead->is_memchunk_identical = false;
+          new_bhead->bhead = bhead;
+          readsize = fd->file->read(fd->file, new_bhead + 1, prefix_size);
+          if (UNLIKELY(readsize != int64_t(prefix_size) ||
+                       fd->file->seek(fd->file, bhead.len - int64_t(prefix_size), SEEK_CUR) ==
+                           -1))
+          {
+            fd->is_eof = true;
+            MEM_freeN(new_bhead);
+            new_bhead = nullptr;
+          }
+        }
+        else {
+          fd->is_eof = true;
+        }
+      }
 #endif
       else {
         new_bhead = static_cast<BHeadN *>(
@@ -869,6 +934,13 @@ static bool blo_bhead_read_data(FileData *fd, BHead *thisblock, void *buf)
   bool success = true;
   BHeadN *new_bhead = BHEADN_FROM_BHEAD(thisblock);
   BLI_assert(new_bhead->has_data == false && new_bhead->file_offset != 0);
+  if (fd->file->read_at != nullptr) {
+    /* Random access reads don't need to seek, which also keeps this thread-safe. */
+    return fd->file->read_at(fd->file,
+                             buf,
+                             size_t(new_bhead->bhead.len),
+                             new_bhead->file_offset) == new_bhead->bhead.len;
+  }
   off64_t offset_backup = fd->file->offset;
   if (UNLIKELY(fd->file->seek(fd->file, new_bhead->file_offset, SEEK_SET) == -1)) {
     success = false;
@@ -1001,6 +1073,11 @@ static bool read_file_dna(FileData *fd, const char **r_error_message)
         BLI_assert(fd->id_name_offset != -1);
         fd->id_asset_data_offset = DNA_struct_member_offset_by_name_with_alias(
             fd->filesdna, "ID", "AssetMetaData", "*asset_data");
+#ifdef USE_BHEAD_READ_ON_DEMAND
+        /* Both have to be available in the partially read ID blocks. */
+        BLI_assert(fd->id_name_offset + MAX_ID_NAME <= BHEAD_ID_PREFIX_SIZE);
+        BLI_assert(fd->id_asset_data_offset + int(sizeof(void *)) <= BHEAD_ID_PREFIX_SIZE);
+#endif
 
         return true;
       }
@@ -1780,7 +1857,34 @@ static void switch_endian_structs(const SDNA *filesdna, BHead *bhead)
   }
 }
 
-static void *read_struct(FileData *fd, BHead *bh, const char *blockname)
+/**
+ * Convert the data of a block from the file's SDNA to the current one.
+ * Arrays with many elements (e.g. geometry in older files) are converted in parallel.
+ */
+static void *read_struct_reconstruct(FileData *fd, BHead *bh)
+{
+  const int new_block_size = DNA_struct_reconstruct_new_size(fd->reconstruct_info, bh->SDNAnr);
+  if (new_block_size == 0) {
+    return nullptr;
+  }
+  void *new_blocks = MEM_callocN(size_t(bh->nr) * size_t(new_block_size), "reconstruct");
+  blender::threading::parallel_for(
+      blender::IndexRange(bh->nr), 4096, [&](const blender::IndexRange range) {
+        DNA_struct_reconstruct_range(fd->reconstruct_info,
+                                     bh->SDNAnr,
+                                     int(range.start()),
+                                     int(range.size()),
+                                     bh + 1,
+                                     new_blocks);
+      });
+  return new_blocks;
+}
+
+/**
+ * Read and convert the data of a block, without modifying the state of `fd`.
+ * Reading errors are reported by setting `r_read_error`.
+ */
+static void *read_struct_ex(FileData *fd, BHead *bh, const char *blockname, bool *r_read_error)
 {
   void *temp = nullptr;
 
@@ -1795,7 +1899,7 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname)
       if (BHEADN_FROM_BHEAD(bh)->has_data == false) {
         bh = blo_bhead_read_full(fd, bh);
         if (UNLIKELY(bh == nullptr)) {
-          fd->flags &= ~FD_FLAGS_FILE_OK;
+          *r_read_error = true;
           return nullptr;
         }
       }
@@ -1809,12 +1913,12 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname)
         if (BHEADN_FROM_BHEAD(bh)->has_data == false) {
           bh = blo_bhead_read_full(fd, bh);
           if (UNLIKELY(bh == nullptr)) {
-            fd->flags &= ~FD_FLAGS_FILE_OK;
+            *r_read_error = true;
             return nullptr;
           }
         }
 #endif
-        temp = DNA_struct_reconstruct(fd->reconstruct_info, bh->SDNAnr, bh->nr, (bh + 1));
+        temp = read_struct_reconstruct(fd, bh);
       }
       else {
         /* SDNA_CMP_EQUAL */
@@ -1827,7 +1931,7 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname)
           /* Instead of allocating the bhead, then copying it,
            * read the data from the file directly into the memory. */
           if (UNLIKELY(!blo_bhead_read_data(fd, bh, temp))) {
-            fd->flags &= ~FD_FLAGS_FILE_OK;
+            *r_read_error = true;
             MEM_freeN(temp);
             temp = nullptr;
           }
@@ -1848,6 +1952,16 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname)
   return temp;
 }
 
+static void *read_struct(FileData *fd, BHead *bh, const char *blockname)
+{
+  bool read_error = false;
+  void *temp = read_struct_ex(fd, bh, blockname, &read_error);
+  if (UNLIKELY(read_error)) {
+    fd->flags &= ~FD_FLAGS_FILE_OK;
+  }
+  return temp;
+}
+
 /* Like read_struct, but gets a pointer without allocating. Only works for
  * undo since DNA must match. */
 static const void *peek_struct_undo(FileData *fd, BHead *bhead)
@@ -2470,9 +2584,76 @@ static bool direct_link_id(FileData *fd, Main *main, const int tag, ID *id, ID *
   return success;
 }
 
+/**
+ * Data blocks of a single ID can be read and converted from multiple threads when the file
+ * supports thread-safe random access (memory-mapped files), and no endian switching is needed
+ * (which converts the data in-place).
+ */
+static bool read_data_can_use_threads(const FileData *fd)
+{
+  return (fd->file->read_at != nullptr) && !(fd->flags & FD_FLAGS_SWITCH_ENDIAN) &&
+         !(fd->flags & FD_FLAGS_IS_MEMFILE);
+}
+
+/**
+ * Read and convert all data blocks of a datablock in parallel, inserting them into the
+ * datamap in file order afterwards, so the result matches sequential reading.
+ */
+static BHead *read_data_into_datamap_threaded(FileData *fd, BHead *bhead, const char *allocname)
+{
+  blender::Vector<BHead *> data_bheads;
+  int64_t data_size = 0;
+  for (bhead = blo_bhead_next(fd, bhead); bhead && bhead->code == BLO_CODE_DATA;
+       bhead = blo_bhead_next(fd, bhead))
+  {
+    data_bheads.append(bhead);
+    data_size += bhead->len;
+  }
+
+  blender::Array<void *> data_blocks(data_bheads.size(), nullptr);
+  std::atomic<bool> read_error = false;
+
+  /* Small IDs are not worth the threading overhead. */
+  const bool use_threading = data_size > 64 * 1024;
+  auto read_range = [&](const blender::IndexRange range) {
+    for (const int64_t i : range) {
+      bool block_read_error = false;
+      data_blocks[i] = read_struct_ex(fd, data_bheads[i], allocname, &block_read_error);
+      if (UNLIKELY(block_read_error)) {
+        read_error.store(true, std::memory_order_relaxed);
+      }
+    }
+  };
+  if (use_threading) {
+    blender::threading::parallel_for_weighted(
+        data_bheads.index_range(), 256 * 1024, read_range, [&](const int64_t i) {
+          return int64_t(data_bheads[i]->len);
+        });
+  }
+  else {
+    read_range(data_bheads.index_range());
+  }
+
+  if (UNLIKELY(read_error)) {
+    fd->flags &= ~FD_FLAGS_FILE_OK;
+  }
+
+  blender::Array<const void *> old_addresses(data_bheads.size());
+  for (const int64_t i : data_bheads.index_range()) {
+    old_addresses[i] = data_bheads[i]->old;
+  }
+  oldnewmap_insert_array(fd->datamap, old_addresses, data_blocks);
+
+  return bhead;
+}
+
 /* Read all data associated with a datablock into datamap. */
 static BHead *read_data_into_datamap(FileData *fd, BHead *bhead, const char *allocname)
 {
+  if (read_data_can_use_threads(fd)) {
+    return read_data_into_datamap_threaded(fd, bhead, allocname);
+  }
+
   bhead = blo_bhead_next(fd, bhead);
 
   while (bhead && bhead->code == BLO_CODE_DATA) {
@@ -3569,6 +3750,8 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
     read_undo_reuse_noundo_local_ids(fd);
   }
 
+  fd->reports->duration.read_data_blocks = BLI_time_now_seconds();
+
   while (bhead) {
     switch (bhead->code) {
       case BLO_CODE_DATA:
@@ -3624,6 +3807,9 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
     }
   }
 
+  fd->reports->duration.read_data_blocks = BLI_time_now_seconds() -
+                                           fd->reports->duration.read_data_blocks;
+
   if (is_undo) {
     /* Move the remaining Library IDs and their linked data to the new main.
      *
@@ -3649,6 +3835,8 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
 
   /* Do versioning before read_libraries, but skip in undo case. */
   if (!is_undo) {
+    const double versioning_start = BLI_time_now_seconds();
+
     if ((fd->skip_flags & BLO_READ_SKIP_DATA) == 0) {
       do_versions(fd, nullptr, bfd->main);
     }
@@ -3656,6 +3844,8 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
     if ((fd->skip_flags & BLO_READ_SKIP_USERDEF) == 0) {
       do_versions_userdef(fd, bfd);
     }
+
+    fd->reports->duration.versioning += BLI_time_now_seconds() - versioning_start;
   }
 
   if (bfd->main->is_read_invalid) {
@@ -3668,8 +3858,10 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
 
     blo_join_main(&mainlist);
 
+    const double lib_link_start = BLI_time_now_seconds();
     lib_link_all(fd, bfd->main);
     after_liblink_merged_bmain_process(bfd->main, fd->reports);
+    fd->reports->duration.lib_link += BLI_time_now_seconds() - lib_link_start;
 
     if (is_undo) {
       /* Ensure ID usages of reused 'no undo' IDs remain valid. */
@@ -3692,6 +3884,7 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
       BKE_main_id_refcount_recompute(bfd->main, false);
 
       /* Yep, second splitting... but this is a very cheap operation, so no big deal. */
+      const double versioning_start = BLI_time_now_seconds();
       blo_split_main(&mainlist, bfd->main);
       LISTBASE_FOREACH (Main *, mainvar, &mainlist) {
         BLI_assert(mainvar->versionfile != 0);
@@ -3700,6 +3893,7 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
             mainvar);
       }
       blo_join_main(&mainlist);
+      fd->reports->duration.versioning += BLI_time_now_seconds() - versioning_start;
 
       /* And we have to compute those user-reference-counts again, as `do_versions_after_linking()`
        * does not always properly handle user counts, and/or that function does not take into
@@ -4754,7 +4948,9 @@ static void read_libraries(FileData *basefd, ListBase *mainlist)
        * Skip versioning in these cases, since the only IDs here will be placeholders (missing
        * lib), or already existing IDs (linking/appending). */
       if (mainptr->curlib->filedata) {
+        const double versioning_start = BLI_time_now_seconds();
         do_versions(mainptr->curlib->filedata, mainptr->curlib, main_newid);
+        basefd->reports->duration.versioning += BLI_time_now_seconds() - versioning_start;
       }
 
       add_main_to_main(mainptr, main_newid);
@@ -4762,7 +4958,9 @@ static void read_libraries(FileData *basefd, ListBase *mainlist)
 
     /* Lib linking. */
     if (mainptr->curlib->filedata) {
+      const double lib_link_start = BLI_time_now_seconds();
       lib_link_all(mainptr->curlib->filedata, mainptr);
+      basefd->reports->duration.lib_link += BLI_time_now_seconds() - lib_link_start;
     }
 
     /* NOTE: No need to call #do_versions_after_linking() or #BKE_main_id_refcount_recompute()
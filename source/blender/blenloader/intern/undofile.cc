@@ -25,6 +25,7 @@
 #include "DNA_listBase.h"
 
 #include "BLI_blenlib.h"
+#include "BLI_hash_mm2a.hh"
 #include "BLI_implicit_sharing.hh"
 
 #include "BLO_readfile.hh"
@@ -41,7 +42,7 @@
 void BLO_memfile_free(MemFile *memfile)
 {
   while (MemFileChunk *chunk = static_cast<MemFileChunk *>(BLI_pophead(&memfile->chunks))) {
-    if (chunk->is_identical == false) {
+    if (chunk->is_identical == false && chunk->is_shared_moved == false) {
       MEM_freeN((void *)chunk->buf);
     }
     MEM_freeN(chunk);
@@ -67,7 +68,7 @@ void BLO_memfile_merge(MemFile *first, MemFile *second)
 
   /* First, detect all memchunks in second memfile that are not owned by it. */
   LISTBASE_FOREACH (MemFileChunk *, sc, &second->chunks) {
-    if (sc->is_identical) {
+    if (sc->is_identical || sc->is_shared_moved) {
       buffer_to_second_memchunk.add(sc->buf, sc);
     }
   }
@@ -75,10 +76,11 @@ void BLO_memfile_merge(MemFile *first, MemFile *second)
   /* Now, check all chunks from first memfile (the one we are removing), and if a memchunk owned by
    * it is also used by the second memfile, transfer the ownership. */
   LISTBASE_FOREACH (MemFileChunk *, fc, &first->chunks) {
-    if (!fc->is_identical) {
+    if (!fc->is_identical && !fc->is_shared_moved) {
       if (MemFileChunk *sc = buffer_to_second_memchunk.lookup_default(fc->buf, nullptr)) {
-        BLI_assert(sc->is_identical);
+        BLI_assert(sc->is_identical || sc->is_shared_moved);
         sc->is_identical = false;
+        sc->is_shared_moved = false;
         fc->is_identical = true;
       }
       /* Note that if the second memfile does not use that chunk, we assume that the first one
@@ -106,6 +108,7 @@ void BLO_memfile_write_init(MemFileWriteData *mem_data,
   mem_data->reference_current_chunk = reference_memfile ? static_cast<MemFileChunk *>(
                                                               reference_memfile->chunks.first) :
                                                           nullptr;
+  mem_data->id_reference_chunks_session_uid = MAIN_ID_SESSION_UID_UNSET;
 
   /* If we have a reference memfile, we generate a mapping between the session_uid's of the
    * IDs stored in that previous undo step, and its first matching memchunk. This will allow
@@ -126,6 +129,52 @@ void BLO_memfile_write_init(MemFileWriteData *mem_data,
 void BLO_memfile_write_finalize(MemFileWriteData *mem_data)
 {
   mem_data->id_session_uid_mapping.clear_and_shrink();
+  mem_data->id_reference_chunks_by_hash.clear_and_shrink();
+}
+
+static uint32_t memfile_chunk_hash(const char *buf, const size_t size)
+{
+  return BLI_hash_mm2(reinterpret_cast<const uchar *>(buf), size, 0);
+}
+
+/**
+ * Find a chunk of the currently written ID in the reference memfile with the same content as
+ * \a buf, regardless of its position.
+ */
+static MemFileChunk *memfile_find_moved_chunk(MemFileWriteData *mem_data,
+                                              const char *buf,
+                                              const size_t size)
+{
+  const uint id_session_uid = mem_data->current_id_session_uid;
+  if (id_session_uid == MAIN_ID_SESSION_UID_UNSET) {
+    return nullptr;
+  }
+  MemFileChunk *ref_chunk = mem_data->id_session_uid_mapping.lookup_default(id_session_uid,
+                                                                            nullptr);
+  if (ref_chunk == nullptr) {
+    /* New ID. */
+    return nullptr;
+  }
+
+  if (mem_data->id_reference_chunks_session_uid != id_session_uid) {
+    mem_data->id_reference_chunks_session_uid = id_session_uid;
+    mem_data->id_reference_chunks_by_hash.clear();
+    for (; ref_chunk != nullptr && ref_chunk->id_session_uid == id_session_uid;
+         ref_chunk = static_cast<MemFileChunk *>(ref_chunk->next))
+    {
+      mem_data->id_reference_chunks_by_hash.add(memfile_chunk_hash(ref_chunk->buf, ref_chunk->size),
+                                               ref_chunk);
+    }
+  }
+
+  MemFileChunk *moved_chunk = mem_data->id_reference_chunks_by_hash.lookup_default(
+      memfile_chunk_hash(buf, size), nullptr);
+  if (moved_chunk == nullptr || moved_chunk->size != size ||
+      memcmp(moved_chunk->buf, buf, size) != 0)
+  {
+    return nullptr;
+  }
+  return moved_chunk;
 }
 
 void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t size)
@@ -138,6 +187,7 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
   curchunk->size = size;
   curchunk->buf = nullptr;
   curchunk->is_identical = false;
+  curchunk->is_shared_moved = false;
   /* This is unsafe in the sense that an app handler or other code that does not
    * perform an undo push may make changes after the last undo push that
    * will then not be undo. Though it's not entirely clear that is wrong behavior. */
@@ -158,6 +208,16 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
     *compchunk_step = static_cast<MemFileChunk *>(compchunk->next);
   }
 
+  /* Not equal, the data may still exist elsewhere in the same ID, e.g. when other data was
+   * inserted before it, in which case the following chunks can be compared in order again. */
+  if (curchunk->buf == nullptr) {
+    if (MemFileChunk *moved_chunk = memfile_find_moved_chunk(mem_data, buf, size)) {
+      curchunk->buf = moved_chunk->buf;
+      curchunk->is_shared_moved = true;
+      *compchunk_step = static_cast<MemFileChunk *>(moved_chunk->next);
+    }
+  }
+
   /* not equal... */
   if (curchunk->buf == nullptr) {
     char *buf_new = static_cast<char *>(MEM_mallocN(size, "Chunk buffer"));
@@ -10,6 +10,7 @@
 
 #include <cstring>
 
+#include "DNA_mesh_types.h"
 #include "DNA_node_types.h"
 #include "DNA_screen_types.h"
 
@@ -17,6 +18,8 @@
 #include "BLI_map.hh"
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #include "BKE_animsys.h"
 #include "BKE_grease_pencil_legacy_convert.hh"
@@ -455,6 +458,19 @@ void version_update_node_input(
   }
 }
 
+void version_meshes_parallel(Main &bmain, FunctionRef<void(Mesh &mesh)> fn)
+{
+  blender::Vector<Mesh *> meshes;
+  LISTBASE_FOREACH (Mesh *, mesh, &bmain.meshes) {
+    meshes.append(mesh);
+  }
+  blender::threading::parallel_for(meshes.index_range(), 1, [&](const blender::IndexRange range) {
+    for (const int64_t i : range) {
+      fn(*meshes[i]);
+    }
+  });
+}
+
 static bool blendfile_or_libraries_versions_atleast(Main *bmain,
                                                     const short versionfile,
                                                     const short subversionfile)
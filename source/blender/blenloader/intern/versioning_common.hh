@@ -19,6 +19,7 @@ struct ID;
 struct IDProperty;
 struct ListBase;
 struct Main;
+struct Mesh;
 struct ViewLayer;
 
 using blender::FunctionRef;
@@ -144,3 +145,10 @@ void version_update_node_input(
     const char *socket_identifier,
     FunctionRef<void(bNode *, bNodeSocket *)> update_input,
     FunctionRef<void(bNode *, bNodeSocket *, bNode *, bNodeSocket *)> update_input_link);
+
+/**
+ * Run a versioning step on all meshes of \a bmain in parallel. This is only valid for steps that
+ * modify nothing but the given mesh (typically conversion of legacy mesh data), since they run
+ * concurrently for different meshes.
+ */
+void version_meshes_parallel(Main &bmain, FunctionRef<void(Mesh &mesh)> fn);
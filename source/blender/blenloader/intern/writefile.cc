@@ -141,6 +141,9 @@
 
 #define ZSTD_COMPRESSION_LEVEL 3
 
+/** Maximum number of bytes queued for writing by #AsyncWriteWrap before blocking. */
+#define ASYNC_WRITE_MAX_QUEUED_SIZE (1 << 25) /* 32mb */
+
 static CLG_LogRef LOG = {"blo.writefile"};
 
 /** Use if we want to store how many bytes have been written to the file. */
@@ -388,6 +391,141 @@ bool ZstdWriteWrap::write(const void *buf, size_t buf_len)
   return true;
 }
 
+/**
+ * Passes data to the base wrapper from a separate thread, so that writing to the file (which
+ * can be slow, e.g. on network drives) overlaps with serializing the data on the main thread.
+ */
+class AsyncWriteWrap : public WriteWrap {
+  WriteWrap &base_wrap;
+
+  ListBase threadpool = {};
+  /** Data waiting to be written, in order (#AsyncWriteBlock). */
+  ListBase blocks = {};
+  size_t blocks_size = 0;
+  ThreadMutex mutex = {};
+  ThreadCondition condition = {};
+
+  bool is_closing = false;
+  bool write_error = false;
+  /** The `errno` of the failed write, which is only set on the writing thread. */
+  int write_errno = 0;
+
+ public:
+  AsyncWriteWrap(WriteWrap &base_wrap) : base_wrap(base_wrap) {}
+
+  bool open(const char *filepath) override;
+  bool close() override;
+  bool write(const void *buf, size_t buf_len) override;
+
+ private:
+  struct AsyncWriteBlock {
+    AsyncWriteBlock *next, *prev;
+    size_t size;
+    /* The data follows this struct. */
+  };
+  static void *write_thread(void *userdata);
+  void write_blocks();
+};
+
+void *AsyncWriteWrap::write_thread(void *userdata)
+{
+  static_cast<AsyncWriteWrap *>(userdata)->write_blocks();
+  return nullptr;
+}
+
+void AsyncWriteWrap::write_blocks()
+{
+  BLI_mutex_lock(&mutex);
+  while (true) {
+    while (BLI_listbase_is_empty(&blocks) && !is_closing) {
+      BLI_condition_wait(&condition, &mutex);
+    }
+    AsyncWriteBlock *block = static_cast<AsyncWriteBlock *>(BLI_pophead(&blocks));
+    if (block == nullptr) {
+      break;
+    }
+    blocks_size -= block->size;
+    BLI_mutex_unlock(&mutex);
+    /* Wake up the main thread in case it is waiting for space in the queue. */
+    BLI_condition_notify_all(&condition);
+
+    const bool success = write_error ? false : base_wrap.write(block + 1, block->size);
+    const int block_errno = errno;
+    MEM_freeN(block);
+
+    BLI_mutex_lock(&mutex);
+    if (!success && !write_error) {
+      write_error = true;
+      write_errno = block_errno;
+    }
+  }
+  BLI_mutex_unlock(&mutex);
+}
+
+bool AsyncWriteWrap::open(const char *filepath)
+{
+  if (!base_wrap.open(filepath)) {
+    return false;
+  }
+
+  BLI_mutex_init(&mutex);
+  BLI_condition_init(&condition);
+  BLI_threadpool_init(&threadpool, write_thread, 1);
+  BLI_threadpool_insert(&threadpool, this);
+
+  return true;
+}
+
+bool AsyncWriteWrap::close()
+{
+  BLI_mutex_lock(&mutex);
+  is_closing = true;
+  BLI_mutex_unlock(&mutex);
+  BLI_condition_notify_all(&condition);
+
+  /* Waits for all queued data to be written. */
+  BLI_threadpool_end(&threadpool);
+  BLI_assert(BLI_listbase_is_empty(&blocks));
+
+  BLI_mutex_end(&mutex);
+  BLI_condition_end(&condition);
+
+  const bool success = base_wrap.close();
+  if (write_error) {
+    /* Report the error of the writing thread, `errno` is thread local. */
+    errno = write_errno;
+    return false;
+  }
+  return success;
+}
+
+bool AsyncWriteWrap::write(const void *buf, size_t buf_len)
+{
+  /* The buffer is reused by the caller, so it has to be copied. */
+  AsyncWriteBlock *block = static_cast<AsyncWriteBlock *>(
+      MEM_mallocN(sizeof(AsyncWriteBlock) + buf_len, __func__));
+  block->size = buf_len;
+  memcpy(block + 1, buf, buf_len);
+
+  BLI_mutex_lock(&mutex);
+  /* Limit memory usage when the file is written slower than data is generated. */
+  while (blocks_size > ASYNC_WRITE_MAX_QUEUED_SIZE && !write_error) {
+    BLI_condition_wait(&condition, &mutex);
+  }
+  if (write_error) {
+    BLI_mutex_unlock(&mutex);
+    MEM_freeN(block);
+    errno = write_errno;
+    return false;
+  }
+  BLI_addtail(&blocks, block);
+  blocks_size += buf_len;
+  BLI_mutex_unlock(&mutex);
+  BLI_condition_notify_all(&condition);
+
+  return true;
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -1599,10 +1737,12 @@ static bool BLO_write_file_impl(Main *mainvar,
   }
 
   /* Actual file writing. */
-  const bool err = write_file_handle(
-      mainvar, &ww, nullptr, nullptr, write_flags, use_userdef, thumb);
+  bool err = write_file_handle(mainvar, &ww, nullptr, nullptr, write_flags, use_userdef, thumb);
 
-  ww.close();
+  /* Writing may be asynchronous, so errors can also be reported when closing. */
+  if (!ww.close()) {
+    err = true;
+  }
 
   if (UNLIKELY(path_list_backup)) {
     BKE_bpath_list_restore(mainvar, path_list_flag, path_list_backup);
@@ -1654,6 +1794,12 @@ bool BLO_write_file(Main *mainvar,
     return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, zstd_wrap);
   }
 
+  if (BLI_system_thread_count() > 1) {
+    /* Compressed files are already written from the compression threads. */
+    AsyncWriteWrap async_wrap(raw_wrap);
+    return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, async_wrap);
+  }
+
   return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, raw_wrap);
 }
 
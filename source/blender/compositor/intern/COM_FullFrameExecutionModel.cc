@@ -4,6 +4,7 @@
 
 #include "COM_FullFrameExecutionModel.h"
 
+#include "BLI_set.hh"
 #include "BLI_string.h"
 
 #include "BLT_translation.hh"
@@ -153,29 +154,36 @@ void FullFrameExecutionModel::render_operations()
 }
 
 /**
- * Returns all dependencies from inputs to outputs. A dependency may be repeated when
- * several operations depend on it.
+ * Returns all dependencies from inputs to outputs, each one only once. The order is depth-first,
+ * so that the buffers of an input branch can be freed before the next branch is rendered,
+ * instead of keeping the buffers of all operations at the same depth alive.
  */
 static Vector<NodeOperation *> get_operation_dependencies(NodeOperation *operation)
 {
-  /* Get dependencies from outputs to inputs. */
   Vector<NodeOperation *> dependencies;
-  Vector<NodeOperation *> next_outputs;
-  next_outputs.append(operation);
-  while (next_outputs.size() > 0) {
-    Vector<NodeOperation *> outputs(next_outputs);
-    next_outputs.clear();
-    for (NodeOperation *output : outputs) {
-      for (int i = 0; i < output->get_number_of_input_sockets(); i++) {
-        next_outputs.append(output->get_input_operation(i));
+  Set<NodeOperation *> visited;
+  visited.add_new(operation);
+
+  /* Operations being visited, with the index of their next input to visit. */
+  Vector<std::pair<NodeOperation *, int>> stack;
+  stack.append({operation, 0});
+  while (!stack.is_empty()) {
+    NodeOperation *op = stack.last().first;
+    const int input_index = stack.last().second;
+    if (input_index < op->get_number_of_input_sockets()) {
+      stack.last().second++;
+      NodeOperation *input = op->get_input_operation(input_index);
+      if (visited.add(input)) {
+        stack.append({input, 0});
       }
+      continue;
+    }
+    stack.pop_last();
+    if (op != operation) {
+      dependencies.append(op);
     }
-    dependencies.extend(next_outputs);
   }
 
-  /* Reverse to get dependencies from inputs to outputs. */
-  std::reverse(dependencies.begin(), dependencies.end());
-
   return dependencies;
 }
 
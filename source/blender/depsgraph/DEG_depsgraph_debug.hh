@@ -50,6 +50,26 @@ void DEG_debug_stats_gnuplot(const Depsgraph *graph,
                              const char *label,
                              const char *output_filename);
 
+/* ************************************************ */
+/* Evaluation Tracing */
+
+/**
+ * Start recording the operations evaluated by the dependency graph, with their timing and the
+ * thread they were evaluated on. An already running recording is discarded.
+ */
+void DEG_debug_trace_begin(Depsgraph *depsgraph);
+
+/**
+ * Stop recording and write the recorded trace in the Chrome trace event JSON format, which can
+ * be opened in `chrome://tracing` or Perfetto. Nothing is written when `fp` is null.
+ *
+ * \return False if no recording was running.
+ */
+bool DEG_debug_trace_end(Depsgraph *depsgraph, FILE *fp);
+
+/** True while operations evaluated by the dependency graph are being recorded. */
+bool DEG_debug_trace_is_recording(const Depsgraph *depsgraph);
+
 /* ************************************************ */
 
 /** Compare two dependency graphs. */
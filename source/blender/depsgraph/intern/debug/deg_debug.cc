@@ -16,12 +16,15 @@
 
 #include "BKE_global.hh"
 
+#include "intern/debug/deg_debug_trace.h"
 #include "intern/depsgraph.hh"
 
 namespace blender::deg {
 
 DepsgraphDebug::DepsgraphDebug() : flags(G.debug), graph_evaluation_start_time_(0) {}
 
+DepsgraphDebug::~DepsgraphDebug() = default;
+
 bool DepsgraphDebug::do_time_debug() const
 {
   return ((G.debug & G_DEBUG_DEPSGRAPH_TIME) != 0);
@@ -29,7 +32,7 @@ bool DepsgraphDebug::do_time_debug() const
 
 void DepsgraphDebug::begin_graph_evaluation()
 {
-  if (!do_time_debug()) {
+  if (!do_time_debug() && trace == nullptr) {
     return;
   }
 
@@ -40,13 +43,20 @@ void DepsgraphDebug::begin_graph_evaluation()
 
 void DepsgraphDebug::end_graph_evaluation()
 {
-  if (!do_time_debug()) {
+  if (!do_time_debug() && trace == nullptr) {
     return;
   }
 
   const double graph_eval_end_time = BLI_time_now_seconds();
   const double graph_eval_time = graph_eval_end_time - graph_evaluation_start_time_;
 
+  if (trace != nullptr) {
+    trace->add_graph_evaluation(name, graph_evaluation_start_time_, graph_eval_end_time);
+  }
+  if (!do_time_debug()) {
+    return;
+  }
+
   if (name.empty()) {
     printf("Depsgraph updated in %f seconds.\n", graph_eval_time);
   }
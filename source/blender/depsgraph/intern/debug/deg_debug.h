@@ -16,9 +16,12 @@
 
 namespace blender::deg {
 
+struct DepsgraphTrace;
+
 class DepsgraphDebug {
  public:
   DepsgraphDebug();
+  ~DepsgraphDebug();
 
   bool do_time_debug() const;
 
@@ -32,6 +35,9 @@ class DepsgraphDebug {
    * created for different view layer). */
   string name;
 
+  /* Recording of evaluated operations, only exists while a trace is being recorded. */
+  unique_ptr<DepsgraphTrace> trace;
+
  protected:
   /* Maximum number of counters used to calculate frame rate of depsgraph update. */
   static const constexpr int MAX_FPS_COUNTERS = 64;
@@ -0,0 +1,152 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#include "intern/debug/deg_debug_trace.h"
+
+#include "BLI_time.h"
+
+#include "DEG_depsgraph_debug.hh"
+
+#include "intern/depsgraph.hh"
+#include "intern/node/deg_node_component.hh"
+#include "intern/node/deg_node_id.hh"
+#include "intern/node/deg_node_operation.hh"
+
+namespace deg = blender::deg;
+
+namespace blender::deg {
+
+namespace {
+
+/* Write string as a JSON string literal, including the quotes. */
+void trace_write_string(FILE *fp, const string &str)
+{
+  fputc('"', fp);
+  for (const char c : str) {
+    if (ELEM(c, '"', '\\')) {
+      fputc('\\', fp);
+      fputc(c, fp);
+    }
+    else if (uchar(c) < 0x20) {
+      fprintf(fp, "\\u%04x", int(c));
+    }
+    else {
+      fputc(c, fp);
+    }
+  }
+  fputc('"', fp);
+}
+
+void trace_write_event(FILE *fp,
+                       const DepsgraphTrace::Event &event,
+                       const double trace_start_time,
+                       const int thread_index,
+                       bool &is_first)
+{
+  if (!is_first) {
+    fputs(",\n", fp);
+  }
+  is_first = false;
+
+  fputs("{\"name\":", fp);
+  trace_write_string(fp, event.name);
+  fputs(",\"cat\":", fp);
+  trace_write_string(fp, event.component_name.empty() ? "graph" : "operation");
+  /* Times are in microseconds. */
+  fprintf(fp,
+          ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f",
+          thread_index,
+          (event.start_time - trace_start_time) * 1e6,
+          (event.end_time - event.start_time) * 1e6);
+  if (!event.id_name.empty()) {
+    fputs(",\"args\":{\"id\":", fp);
+    trace_write_string(fp, event.id_name);
+    fputs(",\"component\":", fp);
+    trace_write_string(fp, event.component_name);
+    fputc('}', fp);
+  }
+  fputc('}', fp);
+}
+
+}  // namespace
+
+DepsgraphTrace::DepsgraphTrace()
+    : start_time(BLI_time_now_seconds()),
+      thread_events([this]() { return ThreadEvents{threads_num.fetch_add(1) + 1, {}}; })
+{
+}
+
+void DepsgraphTrace::add_operation(const OperationNode &operation_node,
+                                   const double start_time,
+                                   const double end_time)
+{
+  const ComponentNode *component_node = operation_node.owner;
+  const IDNode *id_node = component_node->owner;
+  Event event;
+  event.name = operation_node.identifier();
+  event.id_name = id_node->name;
+  event.component_name = component_node->identifier();
+  event.start_time = start_time;
+  event.end_time = end_time;
+  thread_events.local().events.append(std::move(event));
+}
+
+void DepsgraphTrace::add_graph_evaluation(const string &graph_name,
+                                          const double start_time,
+                                          const double end_time)
+{
+  Event event;
+  event.name = graph_name.empty() ? "Depsgraph evaluation" : graph_name;
+  event.start_time = start_time;
+  event.end_time = end_time;
+  graph_evaluations.append(std::move(event));
+}
+
+void DepsgraphTrace::write(FILE *fp)
+{
+  bool is_first = true;
+  fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", fp);
+  /* Whole graph evaluations are done from the thread which requested the update, show them on
+   * their own track. */
+  for (const Event &event : graph_evaluations) {
+    trace_write_event(fp, event, start_time, 0, is_first);
+  }
+  for (const ThreadEvents &events : thread_events) {
+    for (const Event &event : events.events) {
+      trace_write_event(fp, event, start_time, events.thread_index, is_first);
+    }
+  }
+  fputs("\n]}\n", fp);
+}
+
+}  // namespace blender::deg
+
+void DEG_debug_trace_begin(Depsgraph *depsgraph)
+{
+  deg::Depsgraph *deg_graph = reinterpret_cast<deg::Depsgraph *>(depsgraph);
+  deg_graph->debug.trace = std::make_unique<deg::DepsgraphTrace>();
+}
+
+bool DEG_debug_trace_end(Depsgraph *depsgraph, FILE *fp)
+{
+  deg::Depsgraph *deg_graph = reinterpret_cast<deg::Depsgraph *>(depsgraph);
+  if (deg_graph->debug.trace == nullptr) {
+    return false;
+  }
+  if (fp != nullptr) {
+    deg_graph->debug.trace->write(fp);
+  }
+  deg_graph->debug.trace.reset();
+  return true;
+}
+
+bool DEG_debug_trace_is_recording(const Depsgraph *depsgraph)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(depsgraph);
+  return deg_graph->debug.trace != nullptr;
+}
@@ -0,0 +1,60 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdio>
+
+#include "BLI_enumerable_thread_specific.hh"
+#include "BLI_vector.hh"
+
+#include "intern/depsgraph_type.hh"
+
+namespace blender::deg {
+
+struct OperationNode;
+
+/* Recording of the operations evaluated by a dependency graph, which can be exported in the
+ * Chrome trace event format (readable by `chrome://tracing` and Perfetto). */
+struct DepsgraphTrace {
+  struct Event {
+    string name;
+    string id_name;
+    string component_name;
+    double start_time;
+    double end_time;
+  };
+
+  struct ThreadEvents {
+    /* Index used to identify the thread in the exported trace, in order of first recorded
+     * event. */
+    int thread_index;
+    Vector<Event> events;
+  };
+
+  /* Time at which the recording began, exported times are relative to it. */
+  double start_time;
+
+  /* Events of operations, recorded by the threads which evaluated them. */
+  std::atomic<int> threads_num = 0;
+  threading::EnumerableThreadSpecific<ThreadEvents> thread_events;
+
+  /* Events of whole graph evaluations. */
+  Vector<Event> graph_evaluations;
+
+  DepsgraphTrace();
+
+  void add_operation(const OperationNode &operation_node, double start_time, double end_time);
+  void add_graph_evaluation(const string &graph_name, double start_time, double end_time);
+
+  /* Write all recorded events as Chrome trace event JSON. */
+  void write(FILE *fp);
+};
+
+}  // namespace blender::deg
@@ -203,9 +203,11 @@ Relation *Depsgraph::check_nodes_connected(const Node *from,
                                            const Node *to,
                                            const char *description)
 {
-  for (Relation *rel : from->outlinks) {
-    BLI_assert(rel->from == from);
-    if (rel->to != to) {
+  /* Nodes like copy-on-evaluation operations can have thousands of relations on one side, so
+   * only iterate over the shorter of the two relation lists. */
+  const bool use_inlinks = to->inlinks.size() < from->outlinks.size();
+  for (Relation *rel : use_inlinks ? to->inlinks : from->outlinks) {
+    if (rel->from != from || rel->to != to) {
       continue;
     }
     if (description != nullptr && !STREQ(rel->name, description)) {
@@ -32,6 +32,7 @@
 
 #include "atomic_ops.h"
 
+#include "intern/debug/deg_debug_trace.h"
 #include "intern/depsgraph.hh"
 #include "intern/depsgraph_relation.hh"
 #include "intern/depsgraph_tag.hh"
@@ -85,6 +86,24 @@ struct DepsgraphEvalState {
   bool need_single_thread_pass = false;
 };
 
+/* Update the critical path time of the node from its own evaluation time and the critical path
+ * time of its children from their previous evaluation.
+ *
+ * Must be called before scheduling the children, so none of them can be evaluating and modifying
+ * their own time at the same time. */
+void update_critical_path_time(OperationNode *node, const double eval_time)
+{
+  float children_time = 0.0f;
+  for (Relation *rel : node->outlinks) {
+    if (rel->flag & RELATION_FLAG_CYCLIC) {
+      continue;
+    }
+    const OperationNode *child = (OperationNode *)rel->to;
+    children_time = std::max(children_time, child->critical_path_time);
+  }
+  node->critical_path_time = float(eval_time) + children_time;
+}
+
 void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_node)
 {
   ::Depsgraph *depsgraph = reinterpret_cast<::Depsgraph *>(state->graph);
@@ -92,14 +111,17 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
   /* Sanity checks. */
   BLI_assert_msg(!operation_node->is_noop(), "NOOP nodes should not actually be scheduled");
   /* Perform operation. */
+  const double start_time = BLI_time_now_seconds();
+  operation_node->evaluate(depsgraph);
+  const double end_time = BLI_time_now_seconds();
+  const double eval_time = end_time - start_time;
   if (state->do_stats) {
-    const double start_time = BLI_time_now_seconds();
-    operation_node->evaluate(depsgraph);
-    operation_node->stats.current_time += BLI_time_now_seconds() - start_time;
+    operation_node->stats.current_time += eval_time;
   }
-  else {
-    operation_node->evaluate(depsgraph);
+  if (state->graph->debug.trace) {
+    state->graph->debug.trace->add_operation(*operation_node, start_time, end_time);
   }
+  update_critical_path_time(operation_node, eval_time);
 
   /* Clear the flag early on, allowing partial updates without re-evaluating the same node multiple
    * times.
@@ -113,14 +135,26 @@ void deg_task_run_func(TaskPool *pool, void *taskdata)
   void *userdata_v = BLI_task_pool_user_data(pool);
   DepsgraphEvalState *state = (DepsgraphEvalState *)userdata_v;
 
-  /* Evaluate node. */
   OperationNode *operation_node = reinterpret_cast<OperationNode *>(taskdata);
-  evaluate_node(state, operation_node);
+  while (operation_node != nullptr) {
+    /* Evaluate node. */
+    evaluate_node(state, operation_node);
 
-  /* Schedule children. */
-  schedule_children(state, operation_node, [&](OperationNode *node) {
-    BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
-  });
+    /* Schedule children. The one on the most expensive path is evaluated right away by this
+     * thread, the others are pushed to the pool for other threads to pick up. */
+    OperationNode *next_node = nullptr;
+    schedule_children(state, operation_node, [&](OperationNode *node) {
+      if (next_node == nullptr) {
+        next_node = node;
+        return;
+      }
+      if (node->critical_path_time > next_node->critical_path_time) {
+        std::swap(node, next_node);
+      }
+      BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
+    });
+    operation_node = next_node;
+  }
 }
 
 bool check_operation_node_visible(const DepsgraphEvalState *state, OperationNode *op_node)
@@ -273,6 +307,9 @@ void schedule_node(DepsgraphEvalState *state,
        * For normal nodes these are cleared when it is evaluated. */
       node->flag &= ~DEPSOP_FLAG_CLEAR_ON_EVAL;
 
+      /* Keep the critical path time of the chain going through this node. */
+      update_critical_path_time(node, 0.0);
+
       /* skip NOOP node, schedule children right away */
       schedule_children(state, node, schedule_fn);
     }
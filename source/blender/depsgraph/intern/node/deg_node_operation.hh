@@ -281,6 +281,11 @@ struct OperationNode : public Node {
   uint32_t num_links_pending;
   bool scheduled;
 
+  /* Time in seconds it took to evaluate this operation and the most expensive chain of operations
+   * depending on it, as measured during previous evaluations. Used to prioritize the start of long
+   * chains of operations, so they do not end up delaying the whole evaluation. */
+  float critical_path_time;
+
   /* Identifier for the operation being performed. */
   OperationCode opcode;
   int name_tag;
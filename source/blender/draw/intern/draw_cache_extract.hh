@@ -282,6 +282,8 @@ struct MeshBatchCache {
   DRW_Attributes attr_used, attr_needed, attr_used_over_time;
 
   int lastmatch;
+  /** Time the batches were last requested for drawing, used to free caches of hidden meshes. */
+  int lastdrawn;
 
   /* Valid only if edge_detection is up to date. */
   bool is_manifold;
@@ -446,24 +446,19 @@ static void grease_pencil_geom_batch_ensure(Object &object,
     Array<int> verts_start_offsets(verts_start_offsets_size);
     Array<int> tris_start_offsets(tris_start_offsets_size);
 
-    /* Calculate the triangle offsets for all the visible curves. */
+    /* Calculate the triangle and vertex offsets for all the visible curves. The fill triangles
+     * of the drawing include all curves, so the triangle offset also has to account for the
+     * hidden curves in between. */
     int t_offset = 0;
-    int pos = 0;
-    for (const int curve_i : curves.curves_range()) {
-      IndexRange points = points_by_curve[curve_i];
-      if (visible_strokes.contains(curve_i)) {
-        tris_start_offsets[pos] = t_offset;
-        pos++;
-      }
-      if (points.size() >= 3) {
-        t_offset += points.size() - 2;
-      }
-    }
-
-    /* Calculate the vertex offsets for all the visible curves. */
+    int t_offset_curve = 0;
     int num_cyclic = 0;
     int num_points = 0;
     visible_strokes.foreach_index([&](const int curve_i, const int pos) {
+      for (; t_offset_curve < curve_i; t_offset_curve++) {
+        t_offset += std::max<int>(points_by_curve[t_offset_curve].size() - 2, 0);
+      }
+      tris_start_offsets[pos] = t_offset;
+
       IndexRange points = points_by_curve[curve_i];
       const bool is_cyclic = cyclic[curve_i];
 
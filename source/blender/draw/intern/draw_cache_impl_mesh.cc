@@ -23,6 +23,7 @@
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
 #include "BLI_task.h"
+#include "BLI_time.h"
 #include "BLI_utildefines.h"
 
 #include "DNA_mesh_types.h"
@@ -1273,6 +1274,14 @@ void DRW_mesh_batch_cache_free_old(Mesh *mesh, int ctime)
     return;
   }
 
+  if (ctime - cache->lastdrawn > U.vbotimeout) {
+    /* Not drawn for a while (e.g. the object is hidden), free all GPU buffers. They are created
+     * again when the mesh is drawn next time. */
+    DRW_mesh_batch_cache_free(cache);
+    mesh->runtime->batch_cache = nullptr;
+    return;
+  }
+
   if (mesh_cd_layers_type_equal(cache->cd_used_over_time, cache->cd_used)) {
     cache->lastmatch = ctime;
   }
@@ -1355,6 +1364,8 @@ void DRW_mesh_batch_cache_create_requested(TaskGraph *task_graph,
     return;
   }
 
+  cache.lastdrawn = int(BLI_time_now_seconds());
+
 #ifndef NDEBUG
   /* Map the index of a buffer to a flag containing all batches that use it. */
   Map<int, DRWBatchFlag> batches_that_use_buffer_local;
@@ -1000,7 +1000,9 @@ void DRW_cache_free_old_batches(Main *bmain)
        * In this case only the source object should be tagged. */
       DEGObjectIterSettings deg_iter_settings = {nullptr};
       deg_iter_settings.depsgraph = depsgraph;
-      deg_iter_settings.flags = DEG_OBJECT_ITER_FOR_RENDER_ENGINE_FLAGS;
+      /* Include hidden objects, to free the caches of objects that aren't drawn anymore. */
+      deg_iter_settings.flags = DEG_ITER_OBJECT_FLAG_LINKED_DIRECTLY |
+                                DEG_ITER_OBJECT_FLAG_LINKED_VIA_SET | DEG_ITER_OBJECT_FLAG_DUPLI;
       DEG_OBJECT_ITER_BEGIN (&deg_iter_settings, ob) {
         DRW_batch_cache_free_old(ob, ctime);
       }
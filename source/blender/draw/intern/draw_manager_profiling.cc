@@ -292,10 +292,11 @@ void DRW_stats_draw(const rcti *rect)
   /* Memory Stats */
   uint tex_mem = GPU_texture_memory_usage_get();
   uint vbo_mem = GPU_vertbuf_get_memory_usage();
+  uint ibo_mem = GPU_indexbuf_get_memory_usage();
 
   STRNCPY(stat_string, "GPU Memory");
   draw_stat(rect, 0, v, stat_string, sizeof(stat_string));
-  SNPRINTF(stat_string, "%.2fMB", double(tex_mem + vbo_mem) / 1000000.0);
+  SNPRINTF(stat_string, "%.2fMB", double(tex_mem + vbo_mem + ibo_mem) / 1000000.0);
   draw_stat_5row(rect, 1, v++, stat_string, sizeof(stat_string));
   STRNCPY(stat_string, "Textures");
   draw_stat(rect, 1, v, stat_string, sizeof(stat_string));
@@ -305,6 +306,10 @@ void DRW_stats_draw(const rcti *rect)
   draw_stat(rect, 1, v, stat_string, sizeof(stat_string));
   SNPRINTF(stat_string, "%.2fMB", double(vbo_mem) / 1000000.0);
   draw_stat_5row(rect, 1, v++, stat_string, sizeof(stat_string));
+  STRNCPY(stat_string, "Index Buffers");
+  draw_stat(rect, 1, v, stat_string, sizeof(stat_string));
+  SNPRINTF(stat_string, "%.2fMB", double(ibo_mem) / 1000000.0);
+  draw_stat_5row(rect, 1, v++, stat_string, sizeof(stat_string));
   v += 1;
 
   /* GPU Timings */
@@ -10,6 +10,7 @@
 #include "BLI_path_util.h"
 #include "BLI_serialize.hh"
 #include "BLI_string.h"
+#include "BLI_task.h"
 #include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
@@ -249,6 +250,38 @@ static void clear_requested_bakes_in_modifier_cache(BakeGeometryNodesJob &job)
   }
 }
 
+struct BakeFrameWriteTask {
+  const NodeBakeRequest *request;
+  const bake::FrameCache *frame_cache;
+  std::string frame_file_name;
+};
+
+static void write_bake_frame(const NodeBakeRequest &request,
+                             const bake::FrameCache &frame_cache,
+                             const StringRefNull frame_file_name)
+{
+  const bake::BakePath path = request.path;
+
+  char meta_path[FILE_MAX];
+  BLI_path_join(
+      meta_path, sizeof(meta_path), path.meta_dir.c_str(), (frame_file_name + ".json").c_str());
+  BLI_file_ensure_parent_dir_exists(meta_path);
+  bake::DiskBlobWriter blob_writer{path.blobs_dir, frame_file_name};
+  fstream meta_file{meta_path, std::ios::out};
+  bake::serialize_bake(frame_cache.state, blob_writer, *request.blob_sharing, meta_file);
+}
+
+static void write_bake_frame_task_run(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  const BakeFrameWriteTask &task = *static_cast<const BakeFrameWriteTask *>(taskdata);
+  write_bake_frame(*task.request, *task.frame_cache, task.frame_file_name);
+}
+
+static void write_bake_frame_task_free(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  delete static_cast<BakeFrameWriteTask *>(taskdata);
+}
+
 static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *worker_status)
 {
   BakeGeometryNodesJob &job = *static_cast<BakeGeometryNodesJob *>(customdata);
@@ -272,6 +305,11 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
   const float progress_per_frame = frame_step_size / frames_to_bake;
   const int old_frame = job.scene->r.cfra;
 
+  /* Frames are written to disk in the background while the next frame is evaluated. The frame
+   * caches are not modified anymore once evaluated, and only one frame is written at a time
+   * because the blob sharing of each request is not thread-safe. */
+  TaskPool *write_pool = BLI_task_pool_create_background(nullptr, TASK_PRIORITY_HIGH);
+
   for (float frame_f = global_bake_start_frame; frame_f <= global_bake_end_frame;
        frame_f += frame_step_size)
   {
@@ -290,6 +328,8 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
 
     clear_requested_bakes_in_modifier_cache(job);
 
+    BLI_task_pool_work_and_wait(write_pool);
+
     const std::string frame_file_name = bake::frame_to_file_name(frame);
 
     for (NodeBakeRequest &request : job.bake_requests) {
@@ -307,23 +347,20 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
         continue;
       }
 
-      const bake::BakePath path = request.path;
-
-      char meta_path[FILE_MAX];
-      BLI_path_join(meta_path,
-                    sizeof(meta_path),
-                    path.meta_dir.c_str(),
-                    (frame_file_name + ".json").c_str());
-      BLI_file_ensure_parent_dir_exists(meta_path);
-      bake::DiskBlobWriter blob_writer{path.blobs_dir, frame_file_name};
-      fstream meta_file{meta_path, std::ios::out};
-      bake::serialize_bake(frame_cache.state, blob_writer, *request.blob_sharing, meta_file);
+      BLI_task_pool_push(write_pool,
+                         write_bake_frame_task_run,
+                         new BakeFrameWriteTask{&request, &frame_cache, frame_file_name},
+                         true,
+                         write_bake_frame_task_free);
     }
 
     worker_status->progress += progress_per_frame;
     worker_status->do_update = true;
   }
 
+  BLI_task_pool_work_and_wait(write_pool);
+  BLI_task_pool_free(write_pool);
+
   /* Tag simulations as being baked. */
   for (NodeBakeRequest &request : job.bake_requests) {
     if (request.node_type != GEO_NODE_SIMULATION_OUTPUT) {
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <queue>
 
 #include "BKE_attribute.hh"
@@ -235,6 +236,12 @@ struct Node {
   Vector<int> face_indices;
 
   size_t undo_size;
+
+  /**
+   * Held while the node's data is stored during a push, so that the global undo lock doesn't
+   * have to be held while copying.
+   */
+  std::mutex store_mutex;
 };
 
 }
@@ -1559,15 +1559,19 @@ Node *push_node(Object *ob, PBVHNode *node, Type type)
     }
     if ((unode = get_node(node, type))) {
       BLI_thread_unlock(LOCK_CUSTOM1);
+      /* Wait in case another thread is still storing the node's data. */
+      std::lock_guard lock(unode->store_mutex);
       // return unode;
       return;
     }
 
     unode = alloc_node(ob, node, type);
 
-    /* NOTE: If this ever becomes a bottleneck, make a lock inside of the node.
-     * so we release global lock sooner, but keep data locked for until it is
-     * fully initialized. */
+    /* Copying the data can take a while for large nodes. Release the global lock sooner and keep
+     * only this node locked until it is fully initialized, so that nodes are stored in parallel. */
+    std::lock_guard lock(unode->store_mutex);
+    BLI_thread_unlock(LOCK_CUSTOM1);
+
     switch (type) {
       case Type::Position:
         store_coords(ob, unode);
@@ -1594,8 +1598,6 @@ Node *push_node(Object *ob, PBVHNode *node, Type type)
         store_face_sets(*static_cast<const Mesh *>(ob->data), *unode);
         break;
     }
-
-    BLI_thread_unlock(LOCK_CUSTOM1);
   });
 
   /* Store sculpt pivot. */
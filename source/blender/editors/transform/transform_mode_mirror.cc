@@ -12,6 +12,7 @@
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
 
 #include "ED_screen.hh"
 
@@ -37,7 +38,8 @@
  * \param flip: If true, a mirror on all axis will be performed additionally (point
  * reflection).
  */
-static void ElementMirror(TransInfo *t, TransDataContainer *tc, TransData *td, int axis, bool flip)
+static void ElementMirror(
+    const TransInfo *t, const TransDataContainer *tc, TransData *td, int axis, bool flip)
 {
   if ((t->flag & T_V3D_ALIGN) == 0 && td->ext) {
     /* Size checked needed since the 3D cursor only uses rotation fields. */
@@ -150,9 +152,54 @@ static void ElementMirror(TransInfo *t, TransDataContainer *tc, TransData *td, i
   }
 }
 
+struct ElemMirrorData {
+  const TransInfo *t;
+  const TransDataContainer *tc;
+  int axis;
+  bool flip;
+};
+
+static void element_mirror_fn(void *__restrict iter_data_v,
+                              const int iter,
+                              const TaskParallelTLS *__restrict /*tls*/)
+{
+  ElemMirrorData *data = static_cast<ElemMirrorData *>(iter_data_v);
+  TransData *td = &data->tc->data[iter];
+  if (td->flag & TD_SKIP) {
+    return;
+  }
+  ElementMirror(data->t, data->tc, td, data->axis, data->flip);
+}
+
+static void mirror_apply(TransInfo *t, const int axis, const bool flip)
+{
+  FOREACH_TRANS_DATA_CONTAINER (t, tc) {
+    if (tc->data_len < TRANSDATA_THREAD_LIMIT) {
+      TransData *td = tc->data;
+      for (int i = 0; i < tc->data_len; i++, td++) {
+        if (td->flag & TD_SKIP) {
+          continue;
+        }
+
+        ElementMirror(t, tc, td, axis, flip);
+      }
+    }
+    else {
+      ElemMirrorData data{};
+      data.t = t;
+      data.tc = tc;
+      data.axis = axis;
+      data.flip = flip;
+
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      BLI_task_parallel_range(0, tc->data_len, &data, element_mirror_fn, &settings);
+    }
+  }
+}
+
 static void applyMirror(TransInfo *t)
 {
-  int i;
   char str[UI_MAX_DRAW_STR];
   copy_v3_v3(t->values_final, t->values);
 
@@ -176,32 +223,14 @@ static void applyMirror(TransInfo *t)
 
     SNPRINTF(str, IFACE_("Mirror%s"), t->con.text);
 
-    FOREACH_TRANS_DATA_CONTAINER (t, tc) {
-      TransData *td = tc->data;
-      for (i = 0; i < tc->data_len; i++, td++) {
-        if (td->flag & TD_SKIP) {
-          continue;
-        }
-
-        ElementMirror(t, tc, td, special_axis, bitmap_len >= 2);
-      }
-    }
+    mirror_apply(t, special_axis, bitmap_len >= 2);
 
     recalc_data(t);
 
     ED_area_status_text(t->area, str);
   }
   else {
-    FOREACH_TRANS_DATA_CONTAINER (t, tc) {
-      TransData *td = tc->data;
-      for (i = 0; i < tc->data_len; i++, td++) {
-        if (td->flag & TD_SKIP) {
-          continue;
-        }
-
-        ElementMirror(t, tc, td, -1, false);
-      }
-    }
+    mirror_apply(t, -1, false);
 
     recalc_data(t);
 
@@ -250,6 +250,9 @@ static void ed_undo_step_post(bContext *C,
   WM_event_add_notifier(C, NC_WINDOW, nullptr);
   WM_event_add_notifier(C, NC_WM | ND_UNDO, nullptr);
 
+  /* The data now differs from what was last auto-saved. */
+  WM_file_tag_autosave_outdated();
+
   WM_toolsystem_refresh_active(C);
   WM_toolsystem_refresh_screen_all(bmain);
 
@@ -840,106 +840,132 @@ class Executor {
         node, node_state, current_task, local_data, [&](LockedNode &locked_node) {
           BLI_assert(node_state.schedule_state == NodeScheduleState::Scheduled);
           node_state.schedule_state = NodeScheduleState::Running;
-
-          if (node_state.node_has_finished) {
-            return;
+          node_needs_execution = this->prepare_node_execution(locked_node);
+          if (!node_needs_execution) {
+            /* Most nodes run at least once without executing, e.g. when they only request their
+             * inputs. Finish the run here to avoid locking the node a second time. */
+            this->finish_node_run(locked_node, current_task);
           }
+        });
 
-          bool required_uncomputed_output_exists = false;
-          for (const int output_index : node.outputs().index_range()) {
-            OutputState &output_state = node_state.outputs[output_index];
-            output_state.usage_for_execution = output_state.usage;
-            if (output_state.usage == ValueUsage::Used && !output_state.has_been_computed) {
-              required_uncomputed_output_exists = true;
-            }
-          }
-          if (!required_uncomputed_output_exists && !node_state.has_side_effects) {
-            return;
-          }
+    if (!node_needs_execution) {
+      return;
+    }
 
-          if (!node_state.always_used_inputs_requested) {
-            /* Request linked inputs that are always needed. */
-            const Span<Input> fn_inputs = fn.inputs();
-            for (const int input_index : fn_inputs.index_range()) {
-              const Input &fn_input = fn_inputs[input_index];
-              if (fn_input.usage == ValueUsage::Used) {
-                const InputSocket &input_socket = node.input(input_index);
-                if (input_socket.origin() != nullptr) {
-                  this->set_input_required(locked_node, input_socket);
-                }
-              }
-            }
+    if (!node_state.storage_and_defaults_initialized) {
+      /* Initialize storage. */
+      node_state.storage = fn.init_storage(allocator);
 
-            node_state.always_used_inputs_requested = true;
-          }
+      /* Load unlinked inputs. */
+      for (const int input_index : node.inputs().index_range()) {
+        const InputSocket &input_socket = node.input(input_index);
+        if (input_socket.origin() != nullptr) {
+          continue;
+        }
+        InputState &input_state = node_state.inputs[input_index];
+        const CPPType &type = input_socket.type();
+        const void *default_value = input_socket.default_value();
+        BLI_assert(default_value != nullptr);
+        if (self_.logger_ != nullptr) {
+          self_.logger_->log_socket_value(input_socket, {type, default_value}, local_context);
+        }
+        BLI_assert(input_state.value == nullptr);
+        input_state.value = allocator.allocate(type.size(), type.alignment());
+        type.copy_construct(default_value, input_state.value);
+        input_state.was_ready_for_execution = true;
+      }
 
-          for (const int input_index : node.inputs().index_range()) {
-            InputState &input_state = node_state.inputs[input_index];
-            if (input_state.was_ready_for_execution) {
-              continue;
-            }
-            if (input_state.value != nullptr) {
-              input_state.was_ready_for_execution = true;
-              continue;
-            }
-            if (!fn.allow_missing_requested_inputs()) {
-              if (input_state.usage == ValueUsage::Used) {
-                return;
-              }
-            }
-          }
+      node_state.storage_and_defaults_initialized = true;
+    }
 
-          node_needs_execution = true;
+    /* Importantly, the node must not be locked when it is executed. That would result in locks
+     * being hold very long in some cases and results in multiple locks being hold by the same
+     * thread in the same graph which can lead to deadlocks. */
+    this->execute_node(node, node_state, current_task, local_data);
+
+    this->with_locked_node(
+        node, node_state, current_task, local_data, [&](LockedNode &locked_node) {
+#ifndef NDEBUG
+          this->assert_expected_outputs_have_been_computed(locked_node, local_data);
+#endif
+          this->finish_node_run(locked_node, current_task);
         });
+  }
 
-    if (node_needs_execution) {
-      if (!node_state.storage_and_defaults_initialized) {
-        /* Initialize storage. */
-        node_state.storage = fn.init_storage(allocator);
+  /**
+   * Checks whether the node function has to be executed in the current run of the node. The
+   * inputs that are always used are requested the first time this is called.
+   */
+  bool prepare_node_execution(LockedNode &locked_node)
+  {
+    const FunctionNode &node = static_cast<const FunctionNode &>(locked_node.node);
+    NodeState &node_state = locked_node.node_state;
+    const LazyFunction &fn = node.function();
 
-        /* Load unlinked inputs. */
-        for (const int input_index : node.inputs().index_range()) {
+    if (node_state.node_has_finished) {
+      return false;
+    }
+
+    bool required_uncomputed_output_exists = false;
+    for (const int output_index : node.outputs().index_range()) {
+      OutputState &output_state = node_state.outputs[output_index];
+      output_state.usage_for_execution = output_state.usage;
+      if (output_state.usage == ValueUsage::Used && !output_state.has_been_computed) {
+        required_uncomputed_output_exists = true;
+      }
+    }
+    if (!required_uncomputed_output_exists && !node_state.has_side_effects) {
+      return false;
+    }
+
+    if (!node_state.always_used_inputs_requested) {
+      /* Request linked inputs that are always needed. */
+      const Span<Input> fn_inputs = fn.inputs();
+      for (const int input_index : fn_inputs.index_range()) {
+        const Input &fn_input = fn_inputs[input_index];
+        if (fn_input.usage == ValueUsage::Used) {
           const InputSocket &input_socket = node.input(input_index);
           if (input_socket.origin() != nullptr) {
-            continue;
+            this->set_input_required(locked_node, input_socket);
           }
-          InputState &input_state = node_state.inputs[input_index];
-          const CPPType &type = input_socket.type();
-          const void *default_value = input_socket.default_value();
-          BLI_assert(default_value != nullptr);
-          if (self_.logger_ != nullptr) {
-            self_.logger_->log_socket_value(input_socket, {type, default_value}, local_context);
-          }
-          BLI_assert(input_state.value == nullptr);
-          input_state.value = allocator.allocate(type.size(), type.alignment());
-          type.copy_construct(default_value, input_state.value);
-          input_state.was_ready_for_execution = true;
         }
-
-        node_state.storage_and_defaults_initialized = true;
       }
 
-      /* Importantly, the node must not be locked when it is executed. That would result in locks
-       * being hold very long in some cases and results in multiple locks being hold by the same
-       * thread in the same graph which can lead to deadlocks. */
-      this->execute_node(node, node_state, current_task, local_data);
+      node_state.always_used_inputs_requested = true;
     }
 
-    this->with_locked_node(
-        node, node_state, current_task, local_data, [&](LockedNode &locked_node) {
-#ifndef NDEBUG
-          if (node_needs_execution) {
-            this->assert_expected_outputs_have_been_computed(locked_node, local_data);
-          }
-#endif
-          this->finish_node_if_possible(locked_node);
-          const bool reschedule_requested = node_state.schedule_state ==
-                                            NodeScheduleState::RunningAndRescheduled;
-          node_state.schedule_state = NodeScheduleState::NotScheduled;
-          if (reschedule_requested && !node_state.node_has_finished) {
-            this->schedule_node(locked_node, current_task, false);
-          }
-        });
+    for (const int input_index : node.inputs().index_range()) {
+      InputState &input_state = node_state.inputs[input_index];
+      if (input_state.was_ready_for_execution) {
+        continue;
+      }
+      if (input_state.value != nullptr) {
+        input_state.was_ready_for_execution = true;
+        continue;
+      }
+      if (!fn.allow_missing_requested_inputs()) {
+        if (input_state.usage == ValueUsage::Used) {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * Called at the end of every run of a node, also when it was not executed.
+   */
+  void finish_node_run(LockedNode &locked_node, CurrentTask &current_task)
+  {
+    NodeState &node_state = locked_node.node_state;
+    this->finish_node_if_possible(locked_node);
+    const bool reschedule_requested = node_state.schedule_state ==
+                                      NodeScheduleState::RunningAndRescheduled;
+    node_state.schedule_state = NodeScheduleState::NotScheduled;
+    if (reschedule_requested && !node_state.node_has_finished) {
+      this->schedule_node(locked_node, current_task, false);
+    }
   }
 
   void assert_expected_outputs_have_been_computed(LockedNode &locked_node,
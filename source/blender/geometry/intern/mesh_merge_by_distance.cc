@@ -11,6 +11,7 @@
 #include "BLI_kdtree.h"
 #include "BLI_math_vector.h"
 #include "BLI_offset_indices.hh"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "BKE_customdata.hh"
@@ -1706,6 +1707,28 @@ std::optional<Mesh *> mesh_merge_by_distance_all(const Mesh &mesh,
   selection.foreach_index([&](const int64_t i) { BLI_kdtree_3d_insert(tree, i, positions[i]); });
 
   BLI_kdtree_3d_balance(tree);
+
+  /* Usually most vertices have no other vertex in range. Finding them is independent for every
+   * vertex, so do that in parallel and skip them in the serial search for duplicates. Like
+   * merged vertices, they are ignored by the search since their value isn't -1 or their index. */
+  constexpr int isolated_vert = OUT_OF_CONTEXT - 1;
+  threading::parallel_for(selection.index_range(), 1024, [&](const IndexRange range) {
+    selection.slice(range).foreach_index([&](const int i) {
+      bool is_isolated = true;
+      BLI_kdtree_3d_range_search_cb_cpp(
+          tree, positions[i], merge_distance, [&](const int other, const float *, float) {
+            if (other == i) {
+              return true;
+            }
+            is_isolated = false;
+            return false;
+          });
+      if (is_isolated) {
+        vert_dest_map[i] = isolated_vert;
+      }
+    });
+  });
+
   const int vert_kill_len = BLI_kdtree_3d_calc_duplicates_fast(
       tree, merge_distance, true, vert_dest_map.data());
   BLI_kdtree_3d_free(tree);
@@ -1714,6 +1737,14 @@ std::optional<Mesh *> mesh_merge_by_distance_all(const Mesh &mesh,
     return std::nullopt;
   }
 
+  threading::parallel_for(vert_dest_map.index_range(), 4096, [&](const IndexRange range) {
+    for (int &dest : vert_dest_map.as_mutable_span().slice(range)) {
+      if (dest == isolated_vert) {
+        dest = OUT_OF_CONTEXT;
+      }
+    }
+  });
+
   return create_merged_mesh(mesh, vert_dest_map, vert_kill_len, true);
 }
 
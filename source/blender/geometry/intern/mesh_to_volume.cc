@@ -3,7 +3,6 @@
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
 #include "BLI_math_matrix.hh"
-#include "BLI_task.hh"
 
 #include "BKE_volume.hh"
 #include "BKE_volume_grid.hh"
@@ -178,28 +177,19 @@ bke::VolumeGrid<float> mesh_to_sdf_grid(const Span<float3> positions,
     return {};
   }
 
-  std::vector<openvdb::Vec3s> points(positions.size());
-  std::vector<openvdb::Vec3I> triangles(corner_tris.size());
-
-  threading::parallel_for(positions.index_range(), 2048, [&](const IndexRange range) {
-    for (const int i : range) {
-      const float3 &co = positions[i];
-      points[i] = openvdb::Vec3s(co.x, co.y, co.z) - 0.5f * voxel_size;
-    }
-  });
+  float4x4 mesh_to_index_space_transform = math::from_scale<float4x4>(float3(1.0f / voxel_size));
+  /* Better align generated grid with the source mesh. */
+  mesh_to_index_space_transform.location() -= 0.5f;
 
-  threading::parallel_for(corner_tris.index_range(), 2048, [&](const IndexRange range) {
-    for (const int i : range) {
-      const int3 &tri = corner_tris[i];
-      triangles[i] = openvdb::Vec3I(
-          corner_verts[tri[0]], corner_verts[tri[1]], corner_verts[tri[2]]);
-    }
-  });
+  /* Read the mesh data directly instead of copying positions and triangles into separate arrays
+   * for #openvdb::tools::meshToLevelSet, which does the same as this internally. */
+  OpenVDBMeshAdapter mesh_adapter{
+      positions, corner_verts, corner_tris, mesh_to_index_space_transform};
 
   openvdb::math::Transform::Ptr transform = openvdb::math::Transform::createLinearTransform(
       voxel_size);
-  openvdb::FloatGrid::Ptr new_grid = openvdb::tools::meshToLevelSet<openvdb::FloatGrid>(
-      *transform, points, triangles, half_band_width);
+  openvdb::FloatGrid::Ptr new_grid = openvdb::tools::meshToVolume<openvdb::FloatGrid>(
+      mesh_adapter, *transform, half_band_width, half_band_width);
 
   return bke::VolumeGrid<float>(std::move(new_grid));
 }
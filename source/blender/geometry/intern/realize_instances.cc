@@ -9,6 +9,7 @@
 #include "DNA_object_types.h"
 #include "DNA_pointcloud_types.h"
 
+#include "BLI_linear_allocator.hh"
 #include "BLI_listbase.h"
 #include "BLI_math_matrix.hh"
 #include "BLI_math_rotation.hh"
@@ -67,6 +68,24 @@ struct AttributeFallbacksArray {
   AttributeFallbacksArray(int size) : array(size, nullptr) {}
 };
 
+/**
+ * Stores the attribute fallbacks referenced by realize tasks. With many instances, storing a
+ * separate array in every task uses a lot of memory. Consecutive tasks often have the same
+ * fallbacks (e.g. when the instances don't have attributes), so they share the same array.
+ */
+struct AttributeFallbacksStorage {
+  LinearAllocator<> allocator;
+  Span<const void *> last_fallbacks;
+
+  Span<const void *> add(const AttributeFallbacksArray &fallbacks)
+  {
+    if (fallbacks.array.as_span() != last_fallbacks) {
+      last_fallbacks = allocator.construct_array_copy(fallbacks.array.as_span());
+    }
+    return last_fallbacks;
+  }
+};
+
 struct PointCloudRealizeInfo {
   const PointCloud *pointcloud = nullptr;
   /** Matches the order stored in #AllPointCloudsInfo.attributes. */
@@ -84,7 +103,8 @@ struct RealizePointCloudTask {
   const PointCloudRealizeInfo *pointcloud_info;
   /** Transformation that is applied to all positions. */
   float4x4 transform;
-  AttributeFallbacksArray attribute_fallbacks;
+  /** Owned by #GatherTasks, ordered like the corresponding #OrderedAttributes. */
+  Span<const void *> attribute_fallbacks;
   /** Only used when the output contains an output attribute. */
   uint32_t id = 0;
 };
@@ -119,7 +139,8 @@ struct RealizeMeshTask {
   const MeshRealizeInfo *mesh_info;
   /** Transformation that is applied to all positions. */
   float4x4 transform;
-  AttributeFallbacksArray attribute_fallbacks;
+  /** Owned by #GatherTasks, ordered like the corresponding #OrderedAttributes. */
+  Span<const void *> attribute_fallbacks;
   /** Only used when the output contains an output attribute. */
   uint32_t id = 0;
 };
@@ -176,7 +197,8 @@ struct RealizeCurveTask {
   const RealizeCurveInfo *curve_info;
   /* Transformation applied to the position of control points and handles. */
   float4x4 transform;
-  AttributeFallbacksArray attribute_fallbacks;
+  /** Owned by #GatherTasks, ordered like the corresponding #OrderedAttributes. */
+  Span<const void *> attribute_fallbacks;
   /** Only used when the output contains an output attribute. */
   uint32_t id = 0;
 };
@@ -231,6 +253,10 @@ struct GatherTasks {
   Vector<RealizeMeshTask> mesh_tasks;
   Vector<RealizeCurveTask> curve_tasks;
 
+  AttributeFallbacksStorage pointcloud_attribute_fallbacks;
+  AttributeFallbacksStorage mesh_attribute_fallbacks;
+  AttributeFallbacksStorage curve_attribute_fallbacks;
+
   /* Volumes only have very simple support currently. Only the first found volume is put into the
    * output. */
   ImplicitSharingPtr<const bke::VolumeComponent> first_volume;
@@ -351,7 +377,7 @@ static void threaded_fill(const GPointer value, GMutableSpan dst)
 
 static void copy_generic_attributes_to_result(
     const Span<std::optional<GVArraySpan>> src_attributes,
-    const AttributeFallbacksArray &attribute_fallbacks,
+    const Span<const void *> attribute_fallbacks,
     const OrderedAttributes &ordered_attributes,
     const FunctionRef<IndexRange(bke::AttrDomain)> &range_fn,
     MutableSpan<GSpanAttributeWriter> dst_attribute_writers)
@@ -368,9 +394,9 @@ static void copy_generic_attributes_to_result(
           }
           else {
             const CPPType &cpp_type = dst_span.type();
-            const void *fallback = attribute_fallbacks.array[attribute_index] == nullptr ?
+            const void *fallback = attribute_fallbacks[attribute_index] == nullptr ?
                                        cpp_type.default_value() :
-                                       attribute_fallbacks.array[attribute_index];
+                                       attribute_fallbacks[attribute_index];
             threaded_fill({cpp_type, fallback}, dst_span);
           }
         }
@@ -595,10 +621,12 @@ static void gather_realize_tasks_recursive(GatherTasksInfo &gather_info,
         if (mesh != nullptr && mesh->verts_num > 0) {
           const int mesh_index = gather_info.meshes.order.index_of(mesh);
           const MeshRealizeInfo &mesh_info = gather_info.meshes.realize_info[mesh_index];
+          const Span<const void *> attribute_fallbacks =
+              gather_info.r_tasks.mesh_attribute_fallbacks.add(base_instance_context.meshes);
           gather_info.r_tasks.mesh_tasks.append({gather_info.r_offsets.mesh_offsets,
                                                  &mesh_info,
                                                  base_transform,
-                                                 base_instance_context.meshes,
+                                                 attribute_fallbacks,
                                                  base_instance_context.id});
           gather_info.r_offsets.mesh_offsets.vertex += mesh->verts_num;
           gather_info.r_offsets.mesh_offsets.edge += mesh->edges_num;
@@ -615,10 +643,13 @@ static void gather_realize_tasks_recursive(GatherTasksInfo &gather_info,
           const int pointcloud_index = gather_info.pointclouds.order.index_of(pointcloud);
           const PointCloudRealizeInfo &pointcloud_info =
               gather_info.pointclouds.realize_info[pointcloud_index];
+          const Span<const void *> attribute_fallbacks =
+              gather_info.r_tasks.pointcloud_attribute_fallbacks.add(
+                  base_instance_context.pointclouds);
           gather_info.r_tasks.pointcloud_tasks.append({gather_info.r_offsets.pointcloud_offset,
                                                        &pointcloud_info,
                                                        base_transform,
-                                                       base_instance_context.pointclouds,
+                                                       attribute_fallbacks,
                                                        base_instance_context.id});
           gather_info.r_offsets.pointcloud_offset += pointcloud->totpoint;
         }
@@ -630,10 +661,12 @@ static void gather_realize_tasks_recursive(GatherTasksInfo &gather_info,
         if (curves != nullptr && curves->geometry.curve_num > 0) {
           const int curve_index = gather_info.curves.order.index_of(curves);
           const RealizeCurveInfo &curve_info = gather_info.curves.realize_info[curve_index];
+          const Span<const void *> attribute_fallbacks =
+              gather_info.r_tasks.curve_attribute_fallbacks.add(base_instance_context.curves);
           gather_info.r_tasks.curve_tasks.append({gather_info.r_offsets.curves_offsets,
                                                   &curve_info,
                                                   base_transform,
-                                                  base_instance_context.curves,
+                                                  attribute_fallbacks,
                                                   base_instance_context.id});
           gather_info.r_offsets.curves_offsets.point += curves->geometry.point_num;
           gather_info.r_offsets.curves_offsets.curve += curves->geometry.curve_num;
@@ -14,6 +14,7 @@
 #include "BLI_bounds.hh"
 #include "BLI_boxpack_2d.h"
 #include "BLI_convexhull_2d.h"
+#include "BLI_enumerable_thread_specific.hh"
 #include "BLI_listbase.h"
 #include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
@@ -22,6 +23,7 @@
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_rect.h"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "DNA_scene_types.h"
@@ -2263,15 +2265,30 @@ class OverlapMerger {
 
 static void finalize_geometry(const Span<PackIsland *> islands, const UVPackIsland_Params &params)
 {
-  MemArena *arena = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, __func__);
-  Heap *heap = BLI_heap_new();
-  for (const int64_t i : islands.index_range()) {
-    islands[i]->finalize_geometry_(params, arena, heap);
-    BLI_memarena_clear(arena);
-  }
+  /* Islands are finalized independently, each thread uses its own arena and heap. */
+  struct LocalData {
+    MemArena *arena = nullptr;
+    Heap *heap = nullptr;
+    LocalData()
+        : arena(BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, "finalize_geometry")),
+          heap(BLI_heap_new())
+    {
+    }
 
-  BLI_heap_free(heap, nullptr);
-  BLI_memarena_free(arena);
+    ~LocalData()
+    {
+      BLI_heap_free(heap, nullptr);
+      BLI_memarena_free(arena);
+    }
+  };
+  threading::EnumerableThreadSpecific<LocalData> all_local_data;
+  threading::parallel_for(islands.index_range(), 16, [&](const IndexRange range) {
+    LocalData &local_data = all_local_data.local();
+    for (const int64_t i : range) {
+      islands[i]->finalize_geometry_(params, local_data.arena, local_data.heap);
+      BLI_memarena_clear(local_data.arena);
+    }
+  });
 }
 
 float pack_islands(const Span<PackIsland *> islands, const UVPackIsland_Params &params)
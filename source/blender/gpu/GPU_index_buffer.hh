@@ -33,6 +33,10 @@ inline size_t to_bytesize(GPUIndexBufType type)
  * This is because it can be interpreted differently by multiple batches.
  */
 class IndexBuf {
+ public:
+  /** Total size of index buffers on the device, only tracked by some backends. */
+  static size_t memory_usage;
+
  protected:
   /** Type of indices used inside this buffer. */
   GPUIndexBufType index_type_ = GPU_INDEX_U32;
@@ -219,6 +223,9 @@ bool GPU_indexbuf_is_init(blender::gpu::IndexBuf *elem);
 
 int GPU_indexbuf_primitive_len(GPUPrimType prim_type);
 
+/* Metrics */
+uint GPU_indexbuf_get_memory_usage();
+
 /* Macros */
 
 #define GPU_INDEXBUF_DISCARD_SAFE(elem) \
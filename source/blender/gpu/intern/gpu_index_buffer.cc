@@ -299,6 +299,8 @@ IndexBuf *GPU_indexbuf_build_curves_on_device(GPUPrimType prim_type,
 
 namespace blender::gpu {
 
+size_t IndexBuf::memory_usage = 0;
+
 IndexBuf::~IndexBuf()
 {
   if (!is_subrange_) {
@@ -535,4 +537,9 @@ void GPU_indexbuf_update_sub(IndexBuf *elem, uint start, uint len, const void *d
   elem->update_sub(start, len, data);
 }
 
+uint GPU_indexbuf_get_memory_usage()
+{
+  return IndexBuf::memory_usage;
+}
+
 /** \} */
@@ -15,6 +15,7 @@ namespace blender::gpu {
 GLIndexBuf::~GLIndexBuf()
 {
   GLContext::buf_free(ibo_id_);
+  memory_usage -= ibo_size_;
 }
 
 void GLIndexBuf::bind()
@@ -35,6 +36,8 @@ void GLIndexBuf::bind()
     size_t size = this->size_get();
     /* Sends data to GPU. */
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data_, GL_STATIC_DRAW);
+    memory_usage += size - ibo_size_;
+    ibo_size_ = size;
     /* No need to keep copy of data in system memory. */
     MEM_SAFE_FREE(data_);
   }
@@ -23,6 +23,8 @@ class GLIndexBuf : public IndexBuf {
 
  private:
   GLuint ibo_id_ = 0;
+  /** Size of the allocated device buffer, for memory statistics. */
+  size_t ibo_size_ = 0;
 
  public:
   ~GLIndexBuf();
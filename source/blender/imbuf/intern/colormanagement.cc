@@ -1576,6 +1576,33 @@ static void display_buffer_init_handle(void *handle_v,
   handle->float_colorspace = init_data->float_colorspace;
 }
 
+/**
+ * Convert a buffer from the named color space to scene linear. Unlike
+ * #IMB_colormanagement_transform this uses the CPU processor cached on the color space, instead of
+ * creating a new processor for every chunk of every display buffer update.
+ */
+static void display_buffer_to_scene_linear(float *buffer,
+                                           int width,
+                                           int height,
+                                           int channels,
+                                           const char *from_colorspace,
+                                           bool predivide)
+{
+  if (from_colorspace[0] == '\0' || STREQ(from_colorspace, global_role_scene_linear)) {
+    return;
+  }
+
+  ColorSpace *colorspace = colormanage_colorspace_get_named(from_colorspace);
+  if (colorspace == nullptr) {
+    IMB_colormanagement_transform(
+        buffer, width, height, channels, from_colorspace, global_role_scene_linear, predivide);
+    return;
+  }
+
+  IMB_colormanagement_colorspace_to_scene_linear(
+      buffer, width, height, channels, colorspace, predivide);
+}
+
 static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
                                                    int height,
                                                    float *linear_buffer,
@@ -1594,7 +1621,6 @@ static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
     uchar *byte_buffer = handle->byte_buffer;
 
     const char *from_colorspace = handle->byte_colorspace;
-    const char *to_colorspace = global_role_scene_linear;
 
     float *fp;
     uchar *cp;
@@ -1618,8 +1644,8 @@ static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
 
     if (!is_data && !is_data_display) {
       /* convert float buffer to scene linear space */
-      IMB_colormanagement_transform(
-          linear_buffer, width, height, channels, from_colorspace, to_colorspace, false);
+      display_buffer_to_scene_linear(
+          linear_buffer, width, height, channels, from_colorspace, false);
     }
 
     *is_straight_alpha = true;
@@ -1632,13 +1658,12 @@ static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
      */
 
     const char *from_colorspace = handle->float_colorspace;
-    const char *to_colorspace = global_role_scene_linear;
 
     memcpy(linear_buffer, handle->buffer, buffer_size * sizeof(float));
 
     if (!is_data && !is_data_display) {
-      IMB_colormanagement_transform(
-          linear_buffer, width, height, channels, from_colorspace, to_colorspace, predivide);
+      display_buffer_to_scene_linear(
+          linear_buffer, width, height, channels, from_colorspace, predivide);
     }
 
     *is_straight_alpha = false;
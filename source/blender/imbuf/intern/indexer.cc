@@ -31,6 +31,8 @@
 #include "imbuf.hh"
 
 #ifdef WITH_FFMPEG
+#  include "BKE_writeffmpeg.hh"
+
 extern "C" {
 #  include "ffmpeg_compat.h"
 #  include <libavutil/imgutils.h>
@@ -608,31 +610,33 @@ static proxy_output_ctx *alloc_proxy_output_ffmpeg(
       st->codecpar->format != rv->c->pix_fmt)
   {
     rv->frame = av_frame_alloc();
-
-    av_image_fill_arrays(rv->frame->data,
-                         rv->frame->linesize,
-                         static_cast<const uint8_t *>(MEM_mallocN(
-                             av_image_get_buffer_size(rv->c->pix_fmt, width, height, 1),
-                             "alloc proxy output frame")),
-                         rv->c->pix_fmt,
-                         width,
-                         height,
-                         1);
-
     rv->frame->format = rv->c->pix_fmt;
     rv->frame->width = width;
     rv->frame->height = height;
+    ret = av_frame_get_buffer(rv->frame, 0);
+    if (ret < 0) {
+      char error_str[AV_ERROR_MAX_STRING_SIZE];
+      av_make_error_string(error_str, AV_ERROR_MAX_STRING_SIZE, ret);
 
-    rv->sws_ctx = sws_getContext(st->codecpar->width,
-                                 rv->orig_height,
-                                 AVPixelFormat(st->codecpar->format),
-                                 width,
-                                 height,
-                                 rv->c->pix_fmt,
-                                 SWS_FAST_BILINEAR | SWS_PRINT_INFO,
-                                 nullptr,
-                                 nullptr,
-                                 nullptr);
+      fprintf(stderr,
+              "Couldn't allocate proxy output frame: %s\n"
+              "Proxy not built!\n",
+              error_str);
+
+      av_frame_free(&rv->frame);
+      avcodec_free_context(&rv->c);
+      avformat_free_context(rv->of);
+      MEM_freeN(rv);
+      return nullptr;
+    }
+
+    rv->sws_ctx = BKE_ffmpeg_sws_create_context(st->codecpar->width,
+                                                rv->orig_height,
+                                                st->codecpar->format,
+                                                width,
+                                                height,
+                                                rv->c->pix_fmt,
+                                                SWS_FAST_BILINEAR | SWS_PRINT_INFO);
   }
 
   ret = avformat_write_header(rv->of, nullptr);
@@ -667,6 +671,18 @@ static void add_to_proxy_output_ffmpeg(proxy_output_ctx *ctx, AVFrame *frame)
   if (ctx->sws_ctx && frame &&
       (frame->data[0] || frame->data[1] || frame->data[2] || frame->data[3]))
   {
+    /* The output frame is reused, the encoder may still reference the previous buffer. */
+    const int ret = av_frame_make_writable(ctx->frame);
+    if (ret < 0) {
+      char error_str[AV_ERROR_MAX_STRING_SIZE];
+      av_make_error_string(error_str, AV_ERROR_MAX_STRING_SIZE, ret);
+
+      fprintf(stderr, "Can't make proxy output frame writable: %s\n", error_str);
+      return;
+    }
+#  if defined(FFMPEG_SWSCALE_THREADING)
+    sws_scale_frame(ctx->sws_ctx, ctx->frame, frame);
+#  else
     sws_scale(ctx->sws_ctx,
               (const uint8_t *const *)frame->data,
               frame->linesize,
@@ -674,6 +690,7 @@ static void add_to_proxy_output_ffmpeg(proxy_output_ctx *ctx, AVFrame *frame)
               ctx->orig_height,
               ctx->frame->data,
               ctx->frame->linesize);
+#  endif
   }
 
   frame = ctx->sws_ctx ? (frame ? ctx->frame : nullptr) : frame;
@@ -765,9 +782,7 @@ static void free_proxy_output_ffmpeg(proxy_output_ctx *ctx, int rollback)
 
   if (ctx->sws_ctx) {
     sws_freeContext(ctx->sws_ctx);
-
-    MEM_freeN(ctx->frame->data[0]);
-    av_free(ctx->frame);
+    av_frame_free(&ctx->frame);
   }
 
   get_proxy_filepath(ctx->anim, ctx->proxy_size, filepath_tmp, true);
@@ -8,6 +8,7 @@
 
 #include <cmath>
 
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "MEM_guardedalloc.h"
 
@@ -750,19 +751,12 @@ static bool q_scale_linear_interpolation(ImBuf *ibuf, int newx, int newy)
 
 static ImBuf *scaledownx(ImBuf *ibuf, int newx)
 {
+  using namespace blender;
   const bool do_rect = (ibuf->byte_buffer.data != nullptr);
   const bool do_float = (ibuf->float_buffer.data != nullptr);
-  const size_t rect_size = IMB_get_rect_len(ibuf) * 4;
 
-  uchar *rect, *_newrect, *newrect;
-  float *rectf, *_newrectf, *newrectf;
-  float sample, add, val[4], nval[4], valf[4], nvalf[4];
-  int x, y;
-
-  rectf = _newrectf = newrectf = nullptr;
-  rect = _newrect = newrect = nullptr;
-  nval[0] = nval[1] = nval[2] = nval[3] = 0.0f;
-  nvalf[0] = nvalf[1] = nvalf[2] = nvalf[3] = 0.0f;
+  uchar *_newrect = nullptr;
+  float *_newrectf = nullptr;
 
   if (!do_rect && !do_float) {
     return ibuf;
@@ -785,127 +779,116 @@ static ImBuf *scaledownx(ImBuf *ibuf, int newx)
     }
   }
 
-  add = (ibuf->x - 0.01) / newx;
+  const float add = (ibuf->x - 0.01) / newx;
+  const size_t src_stride = size_t(ibuf->x) * 4;
+  const size_t dst_stride = size_t(newx) * 4;
 
-  if (do_rect) {
-    rect = ibuf->byte_buffer.data;
-    newrect = _newrect;
-  }
-  if (do_float) {
-    rectf = ibuf->float_buffer.data;
-    newrectf = _newrectf;
-  }
+  /* Every row is filtered independently. */
+  threading::parallel_for(IndexRange(ibuf->y), 16, [&](const IndexRange y_range) {
+    for (const int64_t y : y_range) {
+      const uchar *rect = do_rect ? ibuf->byte_buffer.data + y * src_stride : nullptr;
+      const float *rectf = do_float ? ibuf->float_buffer.data + y * src_stride : nullptr;
+      uchar *newrect = do_rect ? _newrect + y * dst_stride : nullptr;
+      float *newrectf = do_float ? _newrectf + y * dst_stride : nullptr;
 
-  for (y = ibuf->y; y > 0; y--) {
-    sample = 0.0f;
-    val[0] = val[1] = val[2] = val[3] = 0.0f;
-    valf[0] = valf[1] = valf[2] = valf[3] = 0.0f;
+      float sample = 0.0f;
+      float val[4] = {0.0f}, nval[4] = {0.0f}, valf[4] = {0.0f}, nvalf[4] = {0.0f};
 
-    for (x = newx; x > 0; x--) {
-      if (do_rect) {
-        nval[0] = -val[0] * sample;
-        nval[1] = -val[1] * sample;
-        nval[2] = -val[2] * sample;
-        nval[3] = -val[3] * sample;
-      }
-      if (do_float) {
-        nvalf[0] = -valf[0] * sample;
-        nvalf[1] = -valf[1] * sample;
-        nvalf[2] = -valf[2] * sample;
-        nvalf[3] = -valf[3] * sample;
-      }
+      for (int x = newx; x > 0; x--) {
+        if (do_rect) {
+          nval[0] = -val[0] * sample;
+          nval[1] = -val[1] * sample;
+          nval[2] = -val[2] * sample;
+          nval[3] = -val[3] * sample;
+        }
+        if (do_float) {
+          nvalf[0] = -valf[0] * sample;
+          nvalf[1] = -valf[1] * sample;
+          nvalf[2] = -valf[2] * sample;
+          nvalf[3] = -valf[3] * sample;
+        }
 
-      sample += add;
+        sample += add;
 
-      while (sample >= 1.0f) {
-        sample -= 1.0f;
+        while (sample >= 1.0f) {
+          sample -= 1.0f;
+
+          if (do_rect) {
+            nval[0] += rect[0];
+            nval[1] += rect[1];
+            nval[2] += rect[2];
+            nval[3] += rect[3];
+            rect += 4;
+          }
+          if (do_float) {
+            nvalf[0] += rectf[0];
+            nvalf[1] += rectf[1];
+            nvalf[2] += rectf[2];
+            nvalf[3] += rectf[3];
+            rectf += 4;
+          }
+        }
 
         if (do_rect) {
-          nval[0] += rect[0];
-          nval[1] += rect[1];
-          nval[2] += rect[2];
-          nval[3] += rect[3];
+          val[0] = rect[0];
+          val[1] = rect[1];
+          val[2] = rect[2];
+          val[3] = rect[3];
           rect += 4;
-        }
-        if (do_float) {
-          nvalf[0] += rectf[0];
-          nvalf[1] += rectf[1];
-          nvalf[2] += rectf[2];
-          nvalf[3] += rectf[3];
-          rectf += 4;
-        }
-      }
 
-      if (do_rect) {
-        val[0] = rect[0];
-        val[1] = rect[1];
-        val[2] = rect[2];
-        val[3] = rect[3];
-        rect += 4;
+          newrect[0] = roundf((nval[0] + sample * val[0]) / add);
+          newrect[1] = roundf((nval[1] + sample * val[1]) / add);
+          newrect[2] = roundf((nval[2] + sample * val[2]) / add);
+          newrect[3] = roundf((nval[3] + sample * val[3]) / add);
 
-        newrect[0] = roundf((nval[0] + sample * val[0]) / add);
-        newrect[1] = roundf((nval[1] + sample * val[1]) / add);
-        newrect[2] = roundf((nval[2] + sample * val[2]) / add);
-        newrect[3] = roundf((nval[3] + sample * val[3]) / add);
+          newrect += 4;
+        }
+        if (do_float) {
 
-        newrect += 4;
-      }
-      if (do_float) {
+          valf[0] = rectf[0];
+          valf[1] = rectf[1];
+          valf[2] = rectf[2];
+          valf[3] = rectf[3];
+          rectf += 4;
 
-        valf[0] = rectf[0];
-        valf[1] = rectf[1];
-        valf[2] = rectf[2];
-        valf[3] = rectf[3];
-        rectf += 4;
+          newrectf[0] = ((nvalf[0] + sample * valf[0]) / add);
+          newrectf[1] = ((nvalf[1] + sample * valf[1]) / add);
+          newrectf[2] = ((nvalf[2] + sample * valf[2]) / add);
+          newrectf[3] = ((nvalf[3] + sample * valf[3]) / add);
 
-        newrectf[0] = ((nvalf[0] + sample * valf[0]) / add);
-        newrectf[1] = ((nvalf[1] + sample * valf[1]) / add);
-        newrectf[2] = ((nvalf[2] + sample * valf[2]) / add);
-        newrectf[3] = ((nvalf[3] + sample * valf[3]) / add);
+          newrectf += 4;
+        }
 
-        newrectf += 4;
+        sample -= 1.0f;
       }
 
-      sample -= 1.0f;
+      /* Each row has to consume exactly one source row, see bug #26502. */
+      BLI_assert(!do_rect || rect == ibuf->byte_buffer.data + (y + 1) * src_stride);
+      BLI_assert(!do_float || rectf == ibuf->float_buffer.data + (y + 1) * src_stride);
     }
-  }
+  });
 
   if (do_rect) {
-    // printf("%ld %ld\n", (uchar *)rect - ibuf->byte_buffer.data, rect_size);
-    BLI_assert((uchar *)rect - ibuf->byte_buffer.data == rect_size); /* see bug #26502. */
-
     imb_freerectImBuf(ibuf);
     IMB_assign_byte_buffer(ibuf, _newrect, IB_TAKE_OWNERSHIP);
   }
   if (do_float) {
-    // printf("%ld %ld\n", rectf - ibuf->float_buffer.data, rect_size);
-    BLI_assert((rectf - ibuf->float_buffer.data) == rect_size); /* see bug #26502. */
-
     imb_freerectfloatImBuf(ibuf);
     IMB_assign_float_buffer(ibuf, _newrectf, IB_TAKE_OWNERSHIP);
   }
 
-  (void)rect_size; /* UNUSED in release builds */
-
   ibuf->x = newx;
   return ibuf;
 }
 
 static ImBuf *scaledowny(ImBuf *ibuf, int newy)
 {
+  using namespace blender;
   const bool do_rect = (ibuf->byte_buffer.data != nullptr);
   const bool do_float = (ibuf->float_buffer.data != nullptr);
-  const size_t rect_size = IMB_get_rect_len(ibuf) * 4;
 
-  uchar *rect, *_newrect, *newrect;
-  float *rectf, *_newrectf, *newrectf;
-  float sample, add, val[4], nval[4], valf[4], nvalf[4];
-  int x, y, skipx;
-
-  rectf = _newrectf = newrectf = nullptr;
-  rect = _newrect = newrect = nullptr;
-  nval[0] = nval[1] = nval[2] = nval[3] = 0.0f;
-  nvalf[0] = nvalf[1] = nvalf[2] = nvalf[3] = 0.0f;
+  uchar *_newrect = nullptr;
+  float *_newrectf = nullptr;
 
   if (!do_rect && !do_float) {
     return ibuf;
@@ -928,109 +911,105 @@ static ImBuf *scaledowny(ImBuf *ibuf, int newy)
     }
   }
 
-  add = (ibuf->y - 0.01) / newy;
-  skipx = 4 * ibuf->x;
+  const float add = (ibuf->y - 0.01) / newy;
+  const size_t skipx = size_t(ibuf->x) * 4;
 
-  for (x = skipx - 4; x >= 0; x -= 4) {
-    if (do_rect) {
-      rect = ibuf->byte_buffer.data + x;
-      newrect = _newrect + x;
-    }
-    if (do_float) {
-      rectf = ibuf->float_buffer.data + x;
-      newrectf = _newrectf + x;
-    }
+  /* Every column is filtered independently, process neighboring columns together so that threads
+   * don't share cache lines. */
+  threading::parallel_for(IndexRange(ibuf->x), 64, [&](const IndexRange x_range) {
+    for (const int64_t column : x_range) {
+      const size_t x = size_t(column) * 4;
+      const uchar *rect = do_rect ? ibuf->byte_buffer.data + x : nullptr;
+      const float *rectf = do_float ? ibuf->float_buffer.data + x : nullptr;
+      uchar *newrect = do_rect ? _newrect + x : nullptr;
+      float *newrectf = do_float ? _newrectf + x : nullptr;
 
-    sample = 0.0f;
-    val[0] = val[1] = val[2] = val[3] = 0.0f;
-    valf[0] = valf[1] = valf[2] = valf[3] = 0.0f;
+      float sample = 0.0f;
+      float val[4] = {0.0f}, nval[4] = {0.0f}, valf[4] = {0.0f}, nvalf[4] = {0.0f};
 
-    for (y = newy; y > 0; y--) {
-      if (do_rect) {
-        nval[0] = -val[0] * sample;
-        nval[1] = -val[1] * sample;
-        nval[2] = -val[2] * sample;
-        nval[3] = -val[3] * sample;
-      }
-      if (do_float) {
-        nvalf[0] = -valf[0] * sample;
-        nvalf[1] = -valf[1] * sample;
-        nvalf[2] = -valf[2] * sample;
-        nvalf[3] = -valf[3] * sample;
-      }
+      for (int y = newy; y > 0; y--) {
+        if (do_rect) {
+          nval[0] = -val[0] * sample;
+          nval[1] = -val[1] * sample;
+          nval[2] = -val[2] * sample;
+          nval[3] = -val[3] * sample;
+        }
+        if (do_float) {
+          nvalf[0] = -valf[0] * sample;
+          nvalf[1] = -valf[1] * sample;
+          nvalf[2] = -valf[2] * sample;
+          nvalf[3] = -valf[3] * sample;
+        }
 
-      sample += add;
+        sample += add;
 
-      while (sample >= 1.0f) {
-        sample -= 1.0f;
+        while (sample >= 1.0f) {
+          sample -= 1.0f;
+
+          if (do_rect) {
+            nval[0] += rect[0];
+            nval[1] += rect[1];
+            nval[2] += rect[2];
+            nval[3] += rect[3];
+            rect += skipx;
+          }
+          if (do_float) {
+            nvalf[0] += rectf[0];
+            nvalf[1] += rectf[1];
+            nvalf[2] += rectf[2];
+            nvalf[3] += rectf[3];
+            rectf += skipx;
+          }
+        }
 
         if (do_rect) {
-          nval[0] += rect[0];
-          nval[1] += rect[1];
-          nval[2] += rect[2];
-          nval[3] += rect[3];
+          val[0] = rect[0];
+          val[1] = rect[1];
+          val[2] = rect[2];
+          val[3] = rect[3];
           rect += skipx;
-        }
-        if (do_float) {
-          nvalf[0] += rectf[0];
-          nvalf[1] += rectf[1];
-          nvalf[2] += rectf[2];
-          nvalf[3] += rectf[3];
-          rectf += skipx;
-        }
-      }
 
-      if (do_rect) {
-        val[0] = rect[0];
-        val[1] = rect[1];
-        val[2] = rect[2];
-        val[3] = rect[3];
-        rect += skipx;
+          newrect[0] = roundf((nval[0] + sample * val[0]) / add);
+          newrect[1] = roundf((nval[1] + sample * val[1]) / add);
+          newrect[2] = roundf((nval[2] + sample * val[2]) / add);
+          newrect[3] = roundf((nval[3] + sample * val[3]) / add);
 
-        newrect[0] = roundf((nval[0] + sample * val[0]) / add);
-        newrect[1] = roundf((nval[1] + sample * val[1]) / add);
-        newrect[2] = roundf((nval[2] + sample * val[2]) / add);
-        newrect[3] = roundf((nval[3] + sample * val[3]) / add);
+          newrect += skipx;
+        }
+        if (do_float) {
 
-        newrect += skipx;
-      }
-      if (do_float) {
+          valf[0] = rectf[0];
+          valf[1] = rectf[1];
+          valf[2] = rectf[2];
+          valf[3] = rectf[3];
+          rectf += skipx;
 
-        valf[0] = rectf[0];
-        valf[1] = rectf[1];
-        valf[2] = rectf[2];
-        valf[3] = rectf[3];
-        rectf += skipx;
+          newrectf[0] = ((nvalf[0] + sample * valf[0]) / add);
+          newrectf[1] = ((nvalf[1] + sample * valf[1]) / add);
+          newrectf[2] = ((nvalf[2] + sample * valf[2]) / add);
+          newrectf[3] = ((nvalf[3] + sample * valf[3]) / add);
 
-        newrectf[0] = ((nvalf[0] + sample * valf[0]) / add);
-        newrectf[1] = ((nvalf[1] + sample * valf[1]) / add);
-        newrectf[2] = ((nvalf[2] + sample * valf[2]) / add);
-        newrectf[3] = ((nvalf[3] + sample * valf[3]) / add);
+          newrectf += skipx;
+        }
 
-        newrectf += skipx;
+        sample -= 1.0f;
       }
 
-      sample -= 1.0f;
+      /* Each column has to consume exactly one source column, see bug #26502. */
+      BLI_assert(!do_rect || rect == ibuf->byte_buffer.data + x + ibuf->y * skipx);
+      BLI_assert(!do_float || rectf == ibuf->float_buffer.data + x + ibuf->y * skipx);
     }
-  }
+  });
 
   if (do_rect) {
-    // printf("%ld %ld\n", (uchar *)rect - byte_buffer.data, rect_size);
-    BLI_assert((uchar *)rect - ibuf->byte_buffer.data == rect_size); /* see bug #26502. */
-
     imb_freerectImBuf(ibuf);
     IMB_assign_byte_buffer(ibuf, _newrect, IB_TAKE_OWNERSHIP);
   }
   if (do_float) {
-    // printf("%ld %ld\n", rectf - ibuf->float_buffer.data, rect_size);
-    BLI_assert((rectf - ibuf->float_buffer.data) == rect_size); /* see bug #26502. */
-
     imb_freerectfloatImBuf(ibuf);
     IMB_assign_float_buffer(ibuf, _newrectf, IB_TAKE_OWNERSHIP);
   }
 
-  (void)rect_size; /* UNUSED in release builds */
-
   ibuf->y = newy;
   return ibuf;
 }
@@ -13,9 +13,12 @@
 
 #include "GEO_mesh_merge_by_distance.hh"
 
+#include "BLI_array_utils.hh"
 #include "BLI_color.hh"
 #include "BLI_math_vector.h"
+#include "BLI_offset_indices.hh"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 
 #include "ply_import_mesh.hh"
 
@@ -31,19 +34,21 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
 
   if (!data.edges.is_empty()) {
     MutableSpan<int2> edges = mesh->edges_for_write();
-    for (const int i : data.edges.index_range()) {
-      int32_t v1 = data.edges[i].first;
-      int32_t v2 = data.edges[i].second;
-      if (v1 >= mesh->verts_num) {
-        fprintf(stderr, "Invalid PLY vertex index in edge %i/1: %d\n", i, v1);
-        v1 = 0;
-      }
-      if (v2 >= mesh->verts_num) {
-        fprintf(stderr, "Invalid PLY vertex index in edge %i/2: %d\n", i, v2);
-        v2 = 0;
+    threading::parallel_for(data.edges.index_range(), 4096, [&](const IndexRange range) {
+      for (const int i : range) {
+        int32_t v1 = data.edges[i].first;
+        int32_t v2 = data.edges[i].second;
+        if (v1 >= mesh->verts_num) {
+          fprintf(stderr, "Invalid PLY vertex index in edge %i/1: %d\n", i, v1);
+          v1 = 0;
+        }
+        if (v2 >= mesh->verts_num) {
+          fprintf(stderr, "Invalid PLY vertex index in edge %i/2: %d\n", i, v2);
+          v2 = 0;
+        }
+        edges[i] = {v1, v2};
       }
-      edges[i] = {v1, v2};
-    }
+    });
   }
 
   /* Add faces to the mesh. */
@@ -52,20 +57,23 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
     MutableSpan<int> corner_verts = mesh->corner_verts_for_write();
 
     /* Fill in face data. */
-    uint32_t offset = 0;
     for (const int i : data.face_sizes.index_range()) {
-      uint32_t size = data.face_sizes[i];
-      face_offsets[i] = offset;
-      for (int j = 0; j < size; j++) {
-        uint32_t v = data.face_vertices[offset + j];
-        if (v >= mesh->verts_num) {
-          fprintf(stderr, "Invalid PLY vertex index in face %i loop %i: %u\n", i, j, v);
-          v = 0;
+      face_offsets[i] = int(data.face_sizes[i]);
+    }
+    const OffsetIndices faces = offset_indices::accumulate_counts_to_offsets(face_offsets);
+    threading::parallel_for(faces.index_range(), 4096, [&](const IndexRange range) {
+      for (const int i : range) {
+        const IndexRange face = faces[i];
+        for (const int j : face.index_range()) {
+          uint32_t v = data.face_vertices[face[j]];
+          if (v >= mesh->verts_num) {
+            fprintf(stderr, "Invalid PLY vertex index in face %i loop %i: %u\n", i, j, v);
+            v = 0;
+          }
+          corner_verts[face[j]] = int(v);
         }
-        corner_verts[offset + j] = data.face_vertices[offset + j];
       }
-      offset += size;
-    }
+    });
   }
 
   /* Vertex colors */
@@ -75,14 +83,14 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
         "Col", bke::AttrDomain::Point);
 
     if (params.vertex_colors == PLY_VERTEX_COLOR_SRGB) {
-      for (const int i : data.vertex_colors.index_range()) {
-        srgb_to_linearrgb_v4(colors.span[i], data.vertex_colors[i]);
-      }
+      threading::parallel_for(data.vertex_colors.index_range(), 4096, [&](IndexRange range) {
+        for (const int i : range) {
+          srgb_to_linearrgb_v4(colors.span[i], data.vertex_colors[i]);
+        }
+      });
     }
     else {
-      for (const int i : data.vertex_colors.index_range()) {
-        copy_v4_v4(colors.span[i], data.vertex_colors[i]);
-      }
+      colors.span.copy_from(data.vertex_colors.as_span().cast<ColorGeometry4f>());
     }
     colors.finish();
     BKE_id_attributes_active_color_set(&mesh->id, "Col");
@@ -93,9 +101,8 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
   if (!data.uv_coordinates.is_empty()) {
     bke::SpanAttributeWriter<float2> uv_map = attributes.lookup_or_add_for_write_only_span<float2>(
         "UVMap", bke::AttrDomain::Corner);
-    for (const int i : data.face_vertices.index_range()) {
-      uv_map.span[i] = data.uv_coordinates[data.face_vertices[i]];
-    }
+    const Span<int> corner_verts = mesh->corner_verts();
+    array_utils::gather(data.uv_coordinates.as_span(), corner_verts, uv_map.span);
     uv_map.finish();
   }
 
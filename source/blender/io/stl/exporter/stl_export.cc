@@ -14,7 +14,9 @@
 #include "BKE_object.hh"
 #include "BKE_report.hh"
 
+#include "BLI_array.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 
 #include "DEG_depsgraph_query.hh"
 
@@ -109,19 +111,28 @@ void export_frame(Depsgraph *depsgraph,
     mul_v3_m3v3(xform[3], axes_transform, obj_eval->object_to_world().location());
     xform[3][3] = obj_eval->object_to_world()[3][3];
 
-    /* Write triangles. */
+    /* Write triangles, in batches to limit the size of the temporary buffers. */
     const Span<float3> positions = mesh->vert_positions();
     const blender::Span<int> corner_verts = mesh->corner_verts();
-    for (const int3 &tri : mesh->corner_tris()) {
-      Triangle t;
-      for (int i = 0; i < 3; i++) {
-        float3 pos = positions[corner_verts[tri[i]]];
-        mul_m4_v3(xform, pos);
-        pos *= global_scale;
-        t.vertices[i] = pos;
-      }
-      t.normal = math::normal_tri(t.vertices[0], t.vertices[1], t.vertices[2]);
-      writer->write_triangle(t);
+    const Span<int3> corner_tris = mesh->corner_tris();
+    constexpr int64_t batch_size = 256 * 1024;
+    Array<Triangle> tris(std::min(batch_size, corner_tris.size()), NoInitialization());
+    for (int64_t batch_start = 0; batch_start < corner_tris.size(); batch_start += batch_size) {
+      const IndexRange batch(batch_start, std::min(batch_size, corner_tris.size() - batch_start));
+      threading::parallel_for(batch.index_range(), 4096, [&](const IndexRange range) {
+        for (const int64_t i : range) {
+          const int3 &tri = corner_tris[batch[i]];
+          Triangle &t = tris[i];
+          for (int j = 0; j < 3; j++) {
+            float3 pos = positions[corner_verts[tri[j]]];
+            mul_m4_v3(xform, pos);
+            pos *= global_scale;
+            t.vertices[j] = pos;
+          }
+          t.normal = math::normal_tri(t.vertices[0], t.vertices[1], t.vertices[2]);
+        }
+      });
+      writer->write_triangles(tris.as_span().take_front(batch.size()));
     }
   }
   DEG_OBJECT_ITER_END;
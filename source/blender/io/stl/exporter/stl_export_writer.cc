@@ -6,6 +6,7 @@
  * \ingroup stl
  */
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 #include <stdexcept>
@@ -16,7 +17,10 @@
 
 #include "stl_export_writer.hh"
 
+#include "BLI_array.hh"
 #include "BLI_fileops.h"
+#include "BLI_math_base.h"
+#include "BLI_task.hh"
 
 namespace blender::io::stl {
 
@@ -67,40 +71,60 @@ FileWriter::~FileWriter()
   fclose(file_);
 }
 
-void FileWriter::write_triangle(const Triangle &t)
+void FileWriter::write_triangles(const Span<Triangle> tris)
 {
-  tris_num_++;
+  tris_num_ += tris.size();
   if (ascii_) {
-    fmt::print(file_,
-               "facet normal {} {} {}\n"
-               " outer loop\n"
-               "  vertex {} {} {}\n"
-               "  vertex {} {} {}\n"
-               "  vertex {} {} {}\n"
-               " endloop\n"
-               "endfacet\n",
+    /* Format blocks of triangles in parallel, then write them out in order. */
+    constexpr int64_t block_size = 4096;
+    const int64_t blocks_num = divide_ceil_ul(tris.size(), block_size);
+    Array<fmt::memory_buffer> buffers(blocks_num);
+    threading::parallel_for(IndexRange(blocks_num), 1, [&](const IndexRange range) {
+      for (const int64_t block : range) {
+        fmt::memory_buffer &buf = buffers[block];
+        const int64_t start = block * block_size;
+        for (const Triangle &t : tris.slice(start, std::min(block_size, tris.size() - start))) {
+          fmt::format_to(fmt::appender(buf),
+                         "facet normal {} {} {}\n"
+                         " outer loop\n"
+                         "  vertex {} {} {}\n"
+                         "  vertex {} {} {}\n"
+                         "  vertex {} {} {}\n"
+                         " endloop\n"
+                         "endfacet\n",
 
-               t.normal.x,
-               t.normal.y,
-               t.normal.z,
-               t.vertices[0].x,
-               t.vertices[0].y,
-               t.vertices[0].z,
-               t.vertices[1].x,
-               t.vertices[1].y,
-               t.vertices[1].z,
-               t.vertices[2].x,
-               t.vertices[2].y,
-               t.vertices[2].z);
+                         t.normal.x,
+                         t.normal.y,
+                         t.normal.z,
+                         t.vertices[0].x,
+                         t.vertices[0].y,
+                         t.vertices[0].z,
+                         t.vertices[1].x,
+                         t.vertices[1].y,
+                         t.vertices[1].z,
+                         t.vertices[2].x,
+                         t.vertices[2].y,
+                         t.vertices[2].z);
+        }
+      }
+    });
+    for (const fmt::memory_buffer &buf : buffers) {
+      fwrite(buf.data(), 1, buf.size(), file_);
+    }
   }
   else {
-    ExportBinaryTriangle bin_tri;
-    bin_tri.normal = t.normal;
-    bin_tri.vertices[0] = t.vertices[0];
-    bin_tri.vertices[1] = t.vertices[1];
-    bin_tri.vertices[2] = t.vertices[2];
-    bin_tri.attribute_byte_count = 0;
-    fwrite(&bin_tri, sizeof(ExportBinaryTriangle), 1, file_);
+    Array<ExportBinaryTriangle> bin_tris(tris.size(), NoInitialization());
+    threading::parallel_for(tris.index_range(), 4096, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        ExportBinaryTriangle &bin_tri = bin_tris[i];
+        bin_tri.normal = tris[i].normal;
+        bin_tri.vertices[0] = tris[i].vertices[0];
+        bin_tri.vertices[1] = tris[i].vertices[1];
+        bin_tri.vertices[2] = tris[i].vertices[2];
+        bin_tri.attribute_byte_count = 0;
+      }
+    });
+    fwrite(bin_tris.data(), sizeof(ExportBinaryTriangle), bin_tris.size(), file_);
   }
 }
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "BLI_math_vector_types.hh"
+#include "BLI_span.hh"
 
 namespace blender::io::stl {
 
@@ -21,7 +22,8 @@ class FileWriter {
  public:
   FileWriter(const char *filepath, bool ascii);
   ~FileWriter();
-  void write_triangle(const Triangle &t);
+  /** Triangles are formatted in parallel and written in order. */
+  void write_triangles(Span<Triangle> tris);
 
  private:
   FILE *file_;
@@ -15,6 +15,7 @@
 
 struct Main;
 struct Material;
+struct Mesh;
 struct Object;
 
 namespace blender::io::obj {
@@ -33,10 +34,20 @@ class MeshFromGeometry : NonMovable, NonCopyable {
   {
   }
 
-  Object *create_mesh(Main *bmain,
-                      Map<std::string, std::unique_ptr<MTLMaterial>> &materials,
-                      Map<std::string, Material *> &created_materials,
-                      const OBJImportParams &import_params);
+  /**
+   * Create the mesh data without adding anything to the main database, so that meshes of
+   * different objects can be created in parallel. Returns null for empty geometry.
+   */
+  Mesh *create_mesh(const OBJImportParams &import_params);
+  /**
+   * Add the object for a mesh created by #create_mesh to the main database, taking ownership of the
+   * mesh. Returns null if \a mesh is null.
+   */
+  Object *create_mesh_object(Main *bmain,
+                             Mesh *mesh,
+                             Map<std::string, std::unique_ptr<MTLMaterial>> &materials,
+                             Map<std::string, Material *> &created_materials,
+                             const OBJImportParams &import_params);
 
  private:
   /**
@@ -158,6 +158,23 @@ void *DNA_struct_reconstruct(const struct DNA_ReconstructInfo *reconstruct_info,
                              int old_struct_nr,
                              int blocks,
                              const void *old_blocks);
+/**
+ * \return The size of a single reconstructed struct in the current SDNA,
+ * or zero when the struct doesn't exist anymore.
+ */
+int DNA_struct_reconstruct_new_size(const struct DNA_ReconstructInfo *reconstruct_info,
+                                    int old_struct_nr);
+/**
+ * Reconstruct the array elements in `[block_start, block_start + blocks)` into `new_blocks`,
+ * which has to be zero initialized and large enough for all elements.
+ * This only reads from `reconstruct_info`, so different ranges can be reconstructed in parallel.
+ */
+void DNA_struct_reconstruct_range(const struct DNA_ReconstructInfo *reconstruct_info,
+                                  int old_struct_nr,
+                                  int block_start,
+                                  int blocks,
+                                  const void *old_blocks,
+                                  void *new_blocks);
 
 /**
  * A version of #DNA_struct_member_offset_by_name_with_alias that uses the non-aliased name.
@@ -1155,6 +1155,9 @@ struct DNA_ReconstructInfo {
 
   int *step_counts;
   ReconstructStep **steps;
+
+  /** Index of the matching struct in `newsdna` for every struct in `oldsdna`, or -1. */
+  int *new_struct_nr_from_old;
 };
 
 static void reconstruct_structs(const DNA_ReconstructInfo *reconstruct_info,
@@ -1246,32 +1249,52 @@ static void reconstruct_structs(const DNA_ReconstructInfo *reconstruct_info,
   }
 }
 
-void *DNA_struct_reconstruct(const DNA_ReconstructInfo *reconstruct_info,
-                             int old_struct_nr,
-                             int blocks,
-                             const void *old_blocks)
+int DNA_struct_reconstruct_new_size(const DNA_ReconstructInfo *reconstruct_info,
+                                    const int old_struct_nr)
 {
-  const SDNA *oldsdna = reconstruct_info->oldsdna;
-  const SDNA *newsdna = reconstruct_info->newsdna;
-
-  const SDNA_Struct *old_struct = oldsdna->structs[old_struct_nr];
-  const char *type_name = oldsdna->types[old_struct->type];
-  const int new_struct_nr = DNA_struct_find_without_alias(newsdna, type_name);
-
+  const int new_struct_nr = reconstruct_info->new_struct_nr_from_old[old_struct_nr];
   if (new_struct_nr == -1) {
-    return nullptr;
+    return 0;
   }
+  const SDNA *newsdna = reconstruct_info->newsdna;
+  return newsdna->types_size[newsdna->structs[new_struct_nr]->type];
+}
 
-  const SDNA_Struct *new_struct = newsdna->structs[new_struct_nr];
-  const int new_block_size = newsdna->types_size[new_struct->type];
+void DNA_struct_reconstruct_range(const DNA_ReconstructInfo *reconstruct_info,
+                                  const int old_struct_nr,
+                                  const int block_start,
+                                  const int blocks,
+                                  const void *old_blocks,
+                                  void *new_blocks)
+{
+  const int new_struct_nr = reconstruct_info->new_struct_nr_from_old[old_struct_nr];
+  BLI_assert(new_struct_nr != -1);
+
+  const SDNA *oldsdna = reconstruct_info->oldsdna;
+  const SDNA *newsdna = reconstruct_info->newsdna;
+  const int old_block_size = oldsdna->types_size[oldsdna->structs[old_struct_nr]->type];
+  const int new_block_size = newsdna->types_size[newsdna->structs[new_struct_nr]->type];
 
-  char *new_blocks = static_cast<char *>(MEM_callocN(blocks * new_block_size, "reconstruct"));
   reconstruct_structs(reconstruct_info,
                       blocks,
                       old_struct_nr,
                       new_struct_nr,
-                      static_cast<const char *>(old_blocks),
-                      new_blocks);
+                      static_cast<const char *>(old_blocks) + size_t(block_start) * old_block_size,
+                      static_cast<char *>(new_blocks) + size_t(block_start) * new_block_size);
+}
+
+void *DNA_struct_reconstruct(const DNA_ReconstructInfo *reconstruct_info,
+                             int old_struct_nr,
+                             int blocks,
+                             const void *old_blocks)
+{
+  const int new_block_size = DNA_struct_reconstruct_new_size(reconstruct_info, old_struct_nr);
+  if (new_block_size == 0) {
+    return nullptr;
+  }
+
+  char *new_blocks = static_cast<char *>(MEM_callocN(blocks * new_block_size, "reconstruct"));
+  DNA_struct_reconstruct_range(reconstruct_info, old_struct_nr, 0, blocks, old_blocks, new_blocks);
   return new_blocks;
 }
 
@@ -1564,6 +1587,15 @@ DNA_ReconstructInfo *DNA_reconstruct_info_create(const SDNA *oldsdna,
   reconstruct_info->steps = static_cast<ReconstructStep **>(
       MEM_malloc_arrayN(newsdna->structs_len, sizeof(ReconstructStep *), __func__));
 
+  /* Avoid a name lookup for every reconstructed block. */
+  reconstruct_info->new_struct_nr_from_old = static_cast<int *>(
+      MEM_malloc_arrayN(oldsdna->structs_len, sizeof(int), __func__));
+  for (int old_struct_nr = 0; old_struct_nr < oldsdna->structs_len; old_struct_nr++) {
+    const SDNA_Struct *old_struct = oldsdna->structs[old_struct_nr];
+    reconstruct_info->new_struct_nr_from_old[old_struct_nr] = DNA_struct_find_without_alias(
+        newsdna, oldsdna->types[old_struct->type]);
+  }
+
   /* Generate reconstruct steps for all structs. */
   for (int new_struct_nr = 0; new_struct_nr < newsdna->structs_len; new_struct_nr++) {
     const SDNA_Struct *new_struct = newsdna->structs[new_struct_nr];
@@ -1607,6 +1639,7 @@ void DNA_reconstruct_info_free(DNA_ReconstructInfo *reconstruct_info)
   }
   MEM_freeN(reconstruct_info->steps);
   MEM_freeN(reconstruct_info->step_counts);
+  MEM_freeN(reconstruct_info->new_struct_nr_from_old);
   MEM_freeN(reconstruct_info);
 }
 
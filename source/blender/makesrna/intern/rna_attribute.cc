@@ -346,7 +346,8 @@ static void rna_Attribute_update_data(Main * /*bmain*/, Scene * /*scene*/, Point
 
   /* cheating way for importers to avoid slow updates */
   if (id->us > 0) {
-    DEG_id_tag_update(id, 0);
+    /* Attribute values only affect the geometry, avoid tagging all components of the ID. */
+    DEG_id_tag_update(id, ID_RECALC_GEOMETRY);
     WM_main_add_notifier(NC_GEOM | ND_DATA, id);
   }
 }
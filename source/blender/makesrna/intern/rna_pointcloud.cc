@@ -99,6 +99,7 @@ static void rna_Point_location_get(PointerRNA *ptr, float value[3])
 static void rna_Point_location_set(PointerRNA *ptr, const float value[3])
 {
   copy_v3_v3((float *)ptr->data, value);
+  rna_pointcloud(ptr)->tag_positions_changed();
 }
 
 static float rna_Point_radius_get(PointerRNA *ptr)
@@ -121,6 +122,7 @@ static void rna_Point_radius_set(PointerRNA *ptr, float value)
     return;
   }
   radii[rna_Point_index_get_const(ptr)] = value;
+  pointcloud->tag_radii_changed();
 }
 
 static std::optional<std::string> rna_Point_path(const PointerRNA *ptr)
@@ -931,16 +931,15 @@ static void ensure_bake_loaded(bake::NodeBakeCache &bake_cache, bake::FrameCache
   if (!frame_cache.state.items_by_id.is_empty()) {
     return;
   }
-  if (!bake_cache.blobs_dir) {
+  if (!bake_cache.blob_reader) {
     return;
   }
   if (!frame_cache.meta_path) {
     return;
   }
-  bke::bake::DiskBlobReader blob_reader{*bake_cache.blobs_dir};
   fstream meta_file{*frame_cache.meta_path};
   std::optional<bke::bake::BakeState> bake_state = bke::bake::deserialize_bake(
-      meta_file, blob_reader, *bake_cache.blob_sharing);
+      meta_file, *bake_cache.blob_reader, *bake_cache.blob_sharing);
   if (!bake_state.has_value()) {
     return;
   }
@@ -970,6 +969,7 @@ static bool try_find_baked_data(bake::NodeBakeCache &bake,
   }
   bake.blobs_dir = bake_path->blobs_dir;
   bake.blob_sharing = std::make_unique<bake::BlobReadSharing>();
+  bake.blob_reader = std::make_unique<bake::DiskBlobReader>(bake_path->blobs_dir);
   return true;
 }
 
@@ -449,6 +449,9 @@ class NodeDeclaration {
   Vector<SocketDeclaration *> inputs;
   Vector<SocketDeclaration *> outputs;
   std::unique_ptr<aal::RelationsInNode> anonymous_attribute_relations_;
+  /** How nodes using this declaration interact with fields, derived from the socket declarations
+   * once so that field inferencing does not have to rebuild it for every node on every update. */
+  std::unique_ptr<FieldInferencingInterface> field_inferencing_interface_;
 
   /** Leave the sockets in place, even if they don't match the declaration. Used for dynamic
    * declarations when the information used to build the declaration is missing, but might become
@@ -481,6 +484,11 @@ class NodeDeclaration {
     return anonymous_attribute_relations_.get();
   }
 
+  const FieldInferencingInterface *field_inferencing_interface() const
+  {
+    return field_inferencing_interface_.get();
+  }
+
   MEM_CXX_CLASS_ALLOC_FUNCS("NodeDeclaration")
 };
 
@@ -573,6 +581,7 @@ class NodeDeclarationBuilder {
   void set_active_panel_builder(const PanelDeclarationBuilder *panel_builder);
 
   void build_remaining_anonymous_attribute_relations();
+  void build_field_inferencing_interface();
 };
 
 namespace implicit_field_inputs {
@@ -3,6 +3,7 @@
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
 #include "NOD_node_declaration.hh"
+#include "NOD_socket.hh"
 #include "NOD_socket_declarations.hh"
 #include "NOD_socket_declarations_geometry.hh"
 
@@ -85,9 +86,28 @@ void NodeDeclarationBuilder::build_remaining_anonymous_attribute_relations()
   }
 }
 
+void NodeDeclarationBuilder::build_field_inferencing_interface()
+{
+  auto inferencing_interface = std::make_unique<FieldInferencingInterface>();
+  inferencing_interface->inputs.reserve(declaration_.inputs.size());
+  for (const SocketDeclaration *socket_decl : declaration_.inputs) {
+    inferencing_interface->inputs.append(socket_type_supports_fields(socket_decl->socket_type) ?
+                                             socket_decl->input_field_type :
+                                             InputSocketFieldType::None);
+  }
+  inferencing_interface->outputs.reserve(declaration_.outputs.size());
+  for (const SocketDeclaration *socket_decl : declaration_.outputs) {
+    inferencing_interface->outputs.append(socket_type_supports_fields(socket_decl->socket_type) ?
+                                              socket_decl->output_field_dependency :
+                                              OutputFieldDependency::ForDataSource());
+  }
+  declaration_.field_inferencing_interface_ = std::move(inferencing_interface);
+}
+
 void NodeDeclarationBuilder::finalize()
 {
   this->build_remaining_anonymous_attribute_relations();
+  this->build_field_inferencing_interface();
   BLI_assert(declaration_.is_valid());
 }
 
@@ -5521,6 +5521,43 @@ static bool foreach_compat_buffer(RawPropertyType raw_type, int attr_signed, con
   return false;
 }
 
+/**
+ * Check if a buffer holds floating point values of the other precision than the property, with
+ * one value per element. NumPy arrays default to `float64`, converting those directly avoids the
+ * much slower fallback through Python float objects.
+ */
+static bool foreach_float_buffer_convertible(RawPropertyType raw_type,
+                                            const Py_buffer &buf,
+                                            const int tot)
+{
+  const char f = buf.format ? *buf.format : 'B';
+  if (!((raw_type == PROP_RAW_FLOAT && f == 'd') || (raw_type == PROP_RAW_DOUBLE && f == 'f'))) {
+    return false;
+  }
+  return buf.itemsize > 0 && buf.len == Py_ssize_t(tot) * buf.itemsize;
+}
+
+static void foreach_float_buffer_convert(RawPropertyType src_type,
+                                         const void *src,
+                                         void *dst,
+                                         const int tot)
+{
+  if (src_type == PROP_RAW_DOUBLE) {
+    const double *src_d = static_cast<const double *>(src);
+    float *dst_f = static_cast<float *>(dst);
+    for (int i = 0; i < tot; i++) {
+      dst_f[i] = float(src_d[i]);
+    }
+  }
+  else {
+    const float *src_f = static_cast<const float *>(src);
+    double *dst_d = static_cast<double *>(dst);
+    for (int i = 0; i < tot; i++) {
+      dst_d[i] = double(src_f[i]);
+    }
+  }
+}
+
 static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
 {
   PyObject *item = nullptr;
@@ -5572,6 +5609,14 @@ static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
           ok = RNA_property_collection_raw_set(
               nullptr, &self->ptr, self->prop, attr, buf.buf, raw_type, tot);
         }
+        else if (foreach_float_buffer_convertible(raw_type, buf, tot)) {
+          array = PyMem_Malloc(size * tot);
+          foreach_float_buffer_convert(
+              raw_type == PROP_RAW_FLOAT ? PROP_RAW_DOUBLE : PROP_RAW_FLOAT, buf.buf, array, tot);
+          ok = RNA_property_collection_raw_set(
+              nullptr, &self->ptr, self->prop, attr, array, raw_type, tot);
+          buffer_is_compat = true;
+        }
 
         PyBuffer_Release(&buf);
       }
@@ -5648,6 +5693,15 @@ static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
           ok = RNA_property_collection_raw_get(
               nullptr, &self->ptr, self->prop, attr, buf.buf, raw_type, tot);
         }
+        else if (foreach_float_buffer_convertible(raw_type, buf, tot)) {
+          array = PyMem_Malloc(size * tot);
+          ok = RNA_property_collection_raw_get(
+              nullptr, &self->ptr, self->prop, attr, array, raw_type, tot);
+          if (ok) {
+            foreach_float_buffer_convert(raw_type, array, buf.buf, tot);
+          }
+          buffer_is_compat = true;
+        }
 
         PyBuffer_Release(&buf);
       }
@@ -696,15 +696,13 @@ static void engine_depsgraph_init(RenderEngine *engine, ViewLayer *view_layer)
 static void engine_depsgraph_exit(RenderEngine *engine)
 {
   if (engine->depsgraph) {
-    if (engine_keep_depsgraph(engine)) {
-      /* Clear recalc flags since the engine should have handled the updates for the currently
-       * rendered framed by now. */
-      DEG_ids_clear_recalc(engine->depsgraph, false);
-    }
-    else {
-      /* Free immediately to save memory. */
-      engine_depsgraph_free(engine);
-    }
+    /* Clear recalc flags since the engine should have handled the updates for the currently
+     * rendered framed by now.
+     *
+     * The depsgraph is kept even without persistent data, so that the next view layer of the same
+     * frame can reuse it and only re-evaluate what differs between the view layers, like it is
+     * done with persistent data. It is freed once the whole frame is rendered. */
+    DEG_ids_clear_recalc(engine->depsgraph, false);
   }
 }
 
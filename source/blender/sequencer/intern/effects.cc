@@ -2309,8 +2309,10 @@ static ImBuf *do_speed_effect(const SeqRenderData *context,
     return out;
   }
 
-  /* No interpolation. */
-  return IMB_dupImBuf(ibuf1);
+  /* No interpolation, pass the input through like #StripEarlyOut::UseInput1 does. Further
+   * processing copies the buffer with #IMB_makeSingleUser when it needs to modify it. */
+  IMB_refImBuf(ibuf1);
+  return ibuf1;
 }
 
 /** \} */
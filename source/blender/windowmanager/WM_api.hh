@@ -372,6 +372,8 @@ bool WM_file_read(bContext *C, const char *filepath, ReportList *reports);
 void WM_file_autosave_init(wmWindowManager *wm);
 bool WM_file_recover_last_session(bContext *C, ReportList *reports);
 void WM_file_tag_modified();
+/** Tag the data as changed since the last auto-save, without tagging the file as modified. */
+void WM_file_tag_autosave_outdated();
 
 /**
  * \note `scene` (and related `view_layer` and `v3d`) pointers may be NULL,
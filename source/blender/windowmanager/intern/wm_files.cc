@@ -82,6 +82,7 @@
 #include "BKE_screen.hh"
 #include "BKE_sound.h"
 #include "BKE_undo_system.hh"
+#include "BKE_wm_runtime.hh"
 #include "BKE_workspace.h"
 
 #include "BLO_writefile.hh"
@@ -154,6 +155,7 @@ static CLG_LogRef LOG = {"wm.files"};
 void WM_file_tag_modified()
 {
   wmWindowManager *wm = static_cast<wmWindowManager *>(G_MAIN->wm.first);
+  wm->runtime->autosave_is_outdated = true;
   if (wm->file_saved) {
     wm->file_saved = 0;
     /* Notifier that data changed, for save-over warning or header. */
@@ -161,6 +163,12 @@ void WM_file_tag_modified()
   }
 }
 
+void WM_file_tag_autosave_outdated()
+{
+  wmWindowManager *wm = static_cast<wmWindowManager *>(G_MAIN->wm.first);
+  wm->runtime->autosave_is_outdated = true;
+}
+
 bool wm_file_or_session_data_has_unsaved_changes(const Main *bmain, const wmWindowManager *wm)
 {
   return !wm->file_saved || ED_image_should_save_modified(bmain) ||
@@ -861,6 +869,9 @@ static void wm_read_callback_post_wrapper(bContext *C, const char *filepath, con
 static void file_read_reports_finalize(BlendFileReadReport *bf_reports)
 {
   double duration_whole_minutes, duration_whole_seconds;
+  double duration_read_data_blocks_minutes, duration_read_data_blocks_seconds;
+  double duration_versioning_minutes, duration_versioning_seconds;
+  double duration_lib_link_minutes, duration_lib_link_seconds;
   double duration_libraries_minutes, duration_libraries_seconds;
   double duration_lib_override_minutes, duration_lib_override_seconds;
   double duration_lib_override_resync_minutes, duration_lib_override_resync_seconds;
@@ -873,6 +884,24 @@ static void file_read_reports_finalize(BlendFileReadReport *bf_reports)
                                   &duration_whole_minutes,
                                   &duration_whole_seconds,
                                   nullptr);
+  BLI_math_time_seconds_decompose(bf_reports->duration.read_data_blocks,
+                                  nullptr,
+                                  nullptr,
+                                  &duration_read_data_blocks_minutes,
+                                  &duration_read_data_blocks_seconds,
+                                  nullptr);
+  BLI_math_time_seconds_decompose(bf_reports->duration.versioning,
+                                  nullptr,
+                                  nullptr,
+                                  &duration_versioning_minutes,
+                                  &duration_versioning_seconds,
+                                  nullptr);
+  BLI_math_time_seconds_decompose(bf_reports->duration.lib_link,
+                                  nullptr,
+                                  nullptr,
+                                  &duration_lib_link_minutes,
+                                  &duration_lib_link_seconds,
+                                  nullptr);
   BLI_math_time_seconds_decompose(bf_reports->duration.libraries,
                                   nullptr,
                                   nullptr,
@@ -900,11 +929,26 @@ static void file_read_reports_finalize(BlendFileReadReport *bf_reports)
 
   CLOG_INFO(
       &LOG, 0, "Blender file read in %.0fm%.2fs", duration_whole_minutes, duration_whole_seconds);
+  CLOG_INFO(&LOG,
+            0,
+            " * Reading data-blocks: %.0fm%.2fs",
+            duration_read_data_blocks_minutes,
+            duration_read_data_blocks_seconds);
+  CLOG_INFO(&LOG,
+            0,
+            " * Versioning: %.0fm%.2fs",
+            duration_versioning_minutes,
+            duration_versioning_seconds);
   CLOG_INFO(&LOG,
             0,
             " * Loading libraries: %.0fm%.2fs",
             duration_libraries_minutes,
             duration_libraries_seconds);
+  CLOG_INFO(&LOG,
+            0,
+            " * Linking data-blocks: %.0fm%.2fs",
+            duration_lib_link_minutes,
+            duration_lib_link_seconds);
   CLOG_INFO(&LOG,
             0,
             " * Applying overrides: %.0fm%.2fs",
@@ -2107,6 +2151,12 @@ static bool wm_autosave_write_try(Main *bmain, wmWindowManager *wm)
 
   wm_autosave_location(filepath);
 
+  /* Nothing changed since the last auto-save, so writing it again would give the same file.
+   * Skipping it avoids freezing the interface on large scenes where nothing is being edited. */
+  if (!wm->runtime->autosave_is_outdated && BLI_exists(filepath)) {
+    return true;
+  }
+
   /* Technically, we could always just save here, but that would cause performance regressions
    * compared to when the #MemFile undo step was used for saving undo-steps. So for now just skip
    * auto-save when we are in a mode where auto-save wouldn't have worked previously anyway. This
@@ -2139,7 +2189,9 @@ void WM_autosave_write(wmWindowManager *wm, Main *bmain)
 
   /* Error reporting into console. */
   BlendFileWriteParams params{};
-  BLO_write_file(bmain, filepath, fileflags, &params, nullptr);
+  if (BLO_write_file(bmain, filepath, fileflags, &params, nullptr)) {
+    wm->runtime->autosave_is_outdated = false;
+  }
 
   /* Restart auto-save timer. */
   wm_autosave_timer_end(wm);